@@ -0,0 +1,189 @@
+// benchmarks.cpp - Microbenchmarks for the rating and balancing hot paths
+// Run via `make bench`; each benchmark reports ns/op and ops/sec so
+// releases can be gated on regressions in these numbers
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "MatchIngestion.h"
+#include "TeamBalancer.h"
+#include "TeamGlicko2System.h"
+
+using namespace TeamGlicko2;
+
+namespace {
+    /// Accumulator the benchmarks write into so the optimizer cannot
+    /// discard the measured work
+    volatile double g_sink = 0.0;
+
+    /// Time `iterations` calls of `body` and print one result line
+    template <typename Body>
+    void RunBenchmark(const char* name, std::size_t iterations, Body body) {
+        // Warm-up pass so caches and branch predictors settle
+        for (std::size_t i = 0; i < iterations / 10 + 1; ++i) {
+            body(i);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) {
+            body(i);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        double nanos = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        double nsPerOp = nanos / iterations;
+        double opsPerSec = (nsPerOp > 0.0) ? 1e9 / nsPerOp : 0.0;
+
+        std::printf("%-42s %12.1f ns/op %14.0f ops/sec\n", name, nsPerOp, opsPerSec);
+    }
+
+    /// Build a match with `teamSize` players per side and varied ratings
+    MatchResult MakeMatch(int teamSize, std::mt19937& rng) {
+        std::uniform_real_distribution<double> ratingDist(1100.0, 1800.0);
+        std::uniform_real_distribution<double> rdDist(50.0, 300.0);
+        std::uniform_real_distribution<double> perfDist(100.0, 900.0);
+
+        MatchResult match;
+        for (int i = 0; i < teamSize; ++i) {
+            match.teamA.emplace_back(PlayerRating(ratingDist(rng), rdDist(rng)),
+                                     perfDist(rng), i);
+            match.teamB.emplace_back(PlayerRating(ratingDist(rng), rdDist(rng)),
+                                     perfDist(rng), teamSize + i);
+        }
+        match.scoreA = kWinScore;
+        match.scoreB = kLossScore;
+        return match;
+    }
+
+    /// Build a lobby of `count` players for the balancer
+    std::vector<PlayerInfo> MakeLobby(int count, std::mt19937& rng) {
+        std::uniform_real_distribution<double> ratingDist(1000.0, 2100.0);
+        std::uniform_real_distribution<double> rdDist(40.0, 350.0);
+
+        std::vector<PlayerInfo> players;
+        players.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            players.emplace_back(i, PlayerRating(ratingDist(rng), rdDist(rng)));
+        }
+        return players;
+    }
+
+    void BenchUpdatePlayerRating() {
+        // Easy case: expected result, the volatility solver converges
+        // almost immediately
+        PlayerRating favorite(1700.0, 80.0);
+        RunBenchmark("UpdatePlayerRating (easy convergence)", 200000,
+            [&](std::size_t) {
+                PlayerRating updated = TeamGlicko2System::UpdatePlayerRating(
+                    favorite, -1.0, 0.8, kWinScore, 0.5);
+                g_sink += updated.GetMu();
+            });
+
+        // Hard case: large upset with a confident rating, which drives
+        // the volatility solver through its long bracketing tail
+        PlayerRating upset(1900.0, 35.0);
+        RunBenchmark("UpdatePlayerRating (hard convergence)", 200000,
+            [&](std::size_t) {
+                PlayerRating updated = TeamGlicko2System::UpdatePlayerRating(
+                    upset, -2.5, 0.9, kLossScore, -1.5);
+                g_sink += updated.GetMu();
+            });
+    }
+
+    void BenchProcessMatch() {
+        std::mt19937 rng(12345);
+        const int teamSizes[] = {4, 5, 8};
+
+        for (int teamSize : teamSizes) {
+            // A pool of pre-built matches is cycled so each iteration
+            // sees realistic, varied inputs
+            std::vector<MatchResult> pool;
+            for (int i = 0; i < 64; ++i) {
+                pool.push_back(MakeMatch(teamSize, rng));
+            }
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "ProcessMatch (%dv%d)", teamSize, teamSize);
+
+            MatchScratch scratch;
+            RunBenchmark(name, 50000, [&](std::size_t i) {
+                MatchResult match = pool[i % pool.size()];
+                TeamGlicko2System::ProcessMatch(match, scratch);
+                g_sink += match.teamA[0].rating.GetMu();
+            });
+        }
+    }
+
+    void BenchBalanceTeams() {
+        std::mt19937 rng(54321);
+        const int lobbySizes[] = {8, 10, 12, 14, 16};
+
+        for (int lobbySize : lobbySizes) {
+            std::vector<PlayerInfo> lobby = MakeLobby(lobbySize, rng);
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "BalanceTeams (%d players)", lobbySize);
+
+            std::size_t iterations = (lobbySize >= 14) ? 2000 : 10000;
+            RunBenchmark(name, iterations, [&](std::size_t) {
+                TeamAssignment assignment = TeamBalancer::BalanceTeams(lobby);
+                g_sink += assignment.objectiveValue;
+            });
+        }
+    }
+
+    void BenchCsvReplay(const std::string& csvPath) {
+        // End-to-end replay throughput over the bundled match history;
+        // reported per match rather than per call
+        IngestionStats probe;
+        {
+            RatingStore store;
+            StringInterner interner;
+            if (!MatchIngestion::Replay(csvPath, store, interner, probe)) {
+                std::printf("%-42s %28s\n", "CSV replay (end-to-end)",
+                            "skipped (no input file)");
+                return;
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        const int passes = 5;
+        std::size_t matches = 0;
+        for (int i = 0; i < passes; ++i) {
+            RatingStore store;
+            StringInterner interner;
+            IngestionStats stats;
+            MatchIngestion::Replay(csvPath, store, interner, stats);
+            matches += stats.matchesProcessed;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        double nanos = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        double nsPerMatch = nanos / matches;
+        std::printf("%-42s %12.1f ns/op %14.0f ops/sec  (op = 1 match)\n",
+                    "CSV replay (end-to-end)", nsPerMatch, 1e9 / nsPerMatch);
+    }
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string csvPath = "test/match_stats.csv";
+    if (argc > 1) {
+        csvPath = argv[1];
+    }
+
+    std::printf("TeamGlicko2 Microbenchmarks\n");
+    std::printf("===========================\n\n");
+
+    BenchUpdatePlayerRating();
+    BenchProcessMatch();
+    BenchBalanceTeams();
+    BenchCsvReplay(csvPath);
+
+    // Keep the sink alive
+    std::printf("\n(checksum %g)\n", g_sink);
+    return 0;
+}
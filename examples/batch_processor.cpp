@@ -218,7 +218,7 @@ int main(int argc, char* argv[]) {
                     << ratingBefore.GetRD() << ","
                     << ratingAfter.GetRating() << ","
                     << ratingAfter.GetRD() << ","
-                    << ratingChange << std::endl;
+                    << ratingChange << '\n';  // No per-row flush
         }
 
         processedCount++;
@@ -0,0 +1,55 @@
+// simulation_runner.cpp - Deterministic synthetic simulation runner
+// Generates a seeded population with latent skills, plays matches
+// through TeamBalancer + ProcessMatch, and reports convergence (rating
+// RMSE vs latent skill), mean RD and throughput. Equal seeds give equal
+// runs, so two invocations with different config constants are directly
+// comparable.
+//
+// Usage: simulation_runner [players] [matches] [seed] [lobbySize]
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "RatingSimulator.h"
+
+using namespace TeamGlicko2;
+
+int main(int argc, char* argv[]) {
+    SimulationConfig config;
+    if (argc > 1) config.playerCount = static_cast<std::size_t>(std::atoll(argv[1]));
+    if (argc > 2) config.matchCount = static_cast<std::size_t>(std::atoll(argv[2]));
+    if (argc > 3) config.seed = static_cast<std::uint64_t>(std::atoll(argv[3]));
+    if (argc > 4) config.lobbySize = static_cast<std::size_t>(std::atoll(argv[4]));
+
+    std::cout << "TeamGlicko2 Simulation Runner" << std::endl;
+    std::cout << "=============================" << std::endl;
+    std::cout << "Players: " << config.playerCount
+              << "  Matches: " << config.matchCount
+              << "  Lobby: " << config.lobbySize
+              << "  Seed: " << config.seed << std::endl << std::endl;
+
+    SimulationReport report = RatingSimulator::Run(config);
+    if (report.matchesPlayed == 0) {
+        std::cerr << "Error: empty run (population smaller than lobby?)" << std::endl;
+        return 1;
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(10) << "Matches"
+              << std::setw(12) << "RMSE"
+              << std::setw(12) << "MeanRD" << std::endl;
+    for (const SimulationCheckpoint& checkpoint : report.checkpoints) {
+        std::cout << std::setw(10) << checkpoint.matchesPlayed
+                  << std::setw(12) << checkpoint.rmse
+                  << std::setw(12) << checkpoint.meanRD << std::endl;
+    }
+
+    std::cout << std::endl << "Summary:" << std::endl;
+    std::cout << "========" << std::endl;
+    std::cout << "Final RMSE: " << report.finalRMSE << std::endl;
+    std::cout << "Final mean RD: " << report.finalMeanRD << std::endl;
+    std::cout << "Throughput: " << std::setprecision(0)
+              << report.matchesPerSecond << " matches/sec" << std::endl;
+
+    return 0;
+}
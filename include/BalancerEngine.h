@@ -0,0 +1,66 @@
+#ifndef GLICKO2_INCLUDE_BALANCERENGINE_H_
+#define GLICKO2_INCLUDE_BALANCERENGINE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "TeamBalancer.h"
+
+namespace TeamGlicko2 {
+    /// Concurrent lobby-balancing service built on TeamBalancer
+    /// Owns a pool of worker threads that drain a shared job queue;
+    /// callers submit player lists and receive the resulting
+    /// TeamAssignment through a future, so hundreds of lobbies per
+    /// second can be balanced without each caller managing threads
+    /// Jobs move into the queue and into workers by value, so the
+    /// submitted player vector is never copied after Submit
+    class BalancerEngine {
+    public:
+        /// Start the engine with the given number of worker threads
+        /// @param numThreads Worker count (0 = one per hardware thread)
+        explicit BalancerEngine(std::size_t numThreads = 0);
+
+        /// Stops accepting jobs, finishes queued work and joins workers
+        ~BalancerEngine();
+
+        BalancerEngine(const BalancerEngine&) = delete;
+        BalancerEngine& operator=(const BalancerEngine&) = delete;
+
+        /// Submit a lobby for balancing
+        /// @param players Players to split into two teams (moved in)
+        /// @param config Balancing configuration parameters
+        /// @return Future resolving to the optimal team assignment
+        std::future<TeamAssignment> Submit(
+            std::vector<PlayerInfo> players,
+            const BalancerConfig& config = BalancerConfig());
+
+        /// Number of jobs waiting in the queue (not yet picked up)
+        std::size_t PendingJobs() const;
+
+        /// Number of worker threads in the pool
+        std::size_t WorkerCount() const { return workers.size(); }
+
+    private:
+        /// One queued balancing request
+        struct Job {
+            std::vector<PlayerInfo> players;
+            BalancerConfig config;
+            std::promise<TeamAssignment> promise;
+        };
+
+        /// Worker main loop: pop jobs until the engine shuts down
+        void WorkerLoop();
+
+        std::vector<std::thread> workers;
+        std::deque<Job> jobs;
+        mutable std::mutex jobsMutex;
+        std::condition_variable jobsCondition;
+        bool stopping;
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_BALANCERENGINE_H_
@@ -0,0 +1,101 @@
+#ifndef GLICKO2_INCLUDE_CONCURRENTRATINGTABLE_H_
+#define GLICKO2_INCLUDE_CONCURRENTRATINGTABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "TeamGlickoRating.h"
+
+namespace TeamGlicko2 {
+    /// Sentinel id marking an empty table slot; this id cannot be stored
+    static const std::uint64_t kEmptyRatingSlot = 0xFFFFFFFFFFFFFFFFull;
+
+    /// Thread-safe rating table for concurrent match-result services
+    /// Replaces the "one std::map behind one global mutex" pattern that
+    /// serializes every finishing match: player ids are hashed across a
+    /// fixed set of shards, each shard an independent open-addressing
+    /// table behind its own mutex, so threads updating different players
+    /// almost never contend and a shard rehash only stalls that shard
+    /// Leaderboard scans use Snapshot(), which copies one shard at a
+    /// time, so a full-table read never holds more than one shard lock
+    /// and never blocks writers on the other shards
+    class ConcurrentRatingTable {
+    public:
+        /// One player entry as returned by Snapshot()
+        struct Entry {
+            std::uint64_t playerId;
+            PlayerRating rating;
+        };
+
+        /// @param expectedPlayers Sizing hint for the initial capacity
+        /// @param numShards Lock stripes (rounded up to a power of two)
+        explicit ConcurrentRatingTable(std::size_t expectedPlayers = 1024,
+                                       std::size_t numShards = 64);
+
+        /// Insert or overwrite a player's rating
+        void Put(std::uint64_t playerId, const PlayerRating& rating);
+
+        /// Read a player's rating
+        /// @return true and fills out if the player exists, false otherwise
+        bool TryGet(std::uint64_t playerId, PlayerRating& out) const;
+
+        /// Read-modify-write a player's rating under the shard lock
+        /// Inserts a default-initialized rating first if the player is
+        /// absent; fn receives a mutable PlayerRating& to update in place
+        /// This is the intended path for applying a match result: the
+        /// whole 5-field record updates atomically with respect to readers
+        template <typename Fn>
+        void Apply(std::uint64_t playerId, Fn&& fn) {
+            Shard& shard = ShardFor(playerId);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            fn(LockedFindOrInsert(shard, playerId));
+        }
+
+        /// Copy the full table contents
+        /// Locks one shard at a time; the result is consistent per shard
+        /// but not a single global point-in-time cut, which is the usual
+        /// trade for leaderboard scans that must not block writers
+        std::vector<Entry> Snapshot() const;
+
+        /// Number of players currently stored
+        std::size_t Size() const;
+
+    private:
+        /// One independent open-addressing table plus its lock
+        struct Shard {
+            mutable std::mutex mutex;
+            std::vector<std::uint64_t> ids;     // kEmptyRatingSlot = empty
+            std::vector<PlayerRating> ratings;  // Parallel to ids
+            std::size_t count;
+
+            Shard() : count(0) {}
+        };
+
+        /// Shard owning a player id
+        Shard& ShardFor(std::uint64_t playerId) {
+            return shards[HashId(playerId) & shardMask];
+        }
+        const Shard& ShardFor(std::uint64_t playerId) const {
+            return shards[HashId(playerId) & shardMask];
+        }
+
+        /// 64-bit avalanche mix so sequential ids spread across shards
+        static std::uint64_t HashId(std::uint64_t id);
+
+        /// Find or insert a slot; caller must hold the shard lock
+        PlayerRating& LockedFindOrInsert(Shard& shard, std::uint64_t playerId);
+
+        /// Find an existing slot or SIZE_MAX; caller must hold the shard lock
+        static std::size_t LockedFind(const Shard& shard, std::uint64_t playerId);
+
+        /// Double a shard's table; caller must hold the shard lock
+        static void LockedRehash(Shard& shard);
+
+        std::vector<Shard> shards;
+        std::size_t shardMask;
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_CONCURRENTRATINGTABLE_H_
@@ -0,0 +1,105 @@
+#ifndef GLICKO2_INCLUDE_FIXEDMATCH_H_
+#define GLICKO2_INCLUDE_FIXEDMATCH_H_
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include "TeamGlicko2System.h"
+
+namespace TeamGlicko2 {
+    /// Fixed-size two-team match for titles whose format is known at
+    /// compile time (e.g. always 5v5)
+    /// std::array rosters keep the whole match on the stack; processed
+    /// by ProcessMatchFixed below, which performs no heap allocations
+    template <std::size_t N>
+    struct FixedMatchResult {
+        std::array<MatchPlayer, N> teamA;
+        std::array<MatchPlayer, N> teamB;
+        double scoreA;      // 1.0 = team A win, 0.0 = loss, 0.5 = draw
+        double scoreB;
+    };
+
+    /// Internal helpers for the fixed-size kernel; the loop bodies
+    /// mirror the dynamic pipeline step for step so both paths produce
+    /// identical results for the same inputs
+    namespace fixedmatch_internal {
+        /// Team aggregation over a fixed roster (same fused loop as
+        /// TeamRatingAggregator's column overload)
+        template <std::size_t N>
+        inline TeamRatingStats ComputeTeamStats(const std::array<MatchPlayer, N>& team) {
+            double muSum = 0.0;
+            double phiSumSquares = 0.0;
+            for (std::size_t i = 0; i < N; ++i) {
+                double phi = team[i].rating.GetPhi();
+                muSum += team[i].rating.GetMu();
+                phiSumSquares += phi * phi;
+            }
+
+            TeamRatingStats stats;
+            stats.teamSize = static_cast<int>(N);
+            stats.mu = muSum / N;
+            stats.phi = std::sqrt(phiSumSquares / (static_cast<double>(N) * N));
+            return stats;
+        }
+
+        /// Performance z-scores over a fixed roster (same Welford pass
+        /// and epsilon convention as PerformanceWeighting)
+        template <std::size_t N>
+        inline void ComputeZScores(const std::array<MatchPlayer, N>& team,
+                                   std::array<double, N>& outZ) {
+            double mean = 0.0;
+            double m2 = 0.0;
+            for (std::size_t i = 0; i < N; ++i) {
+                double score = team[i].performanceScore;
+                double delta = score - mean;
+                mean += delta / static_cast<double>(i + 1);
+                m2 += delta * (score - mean);
+            }
+            double variance = m2 / static_cast<double>(N);
+            double stddev = std::sqrt(variance) + TeamGlicko2::kEpsilon;
+
+            for (std::size_t i = 0; i < N; ++i) {
+                outZ[i] = (team[i].performanceScore - mean) / stddev;
+            }
+        }
+    }  // namespace fixedmatch_internal
+
+    /// Process one fixed-size match through the full pipeline
+    /// Compile-time twin of TeamGlicko2System::ProcessMatch: with N
+    /// known, every per-player loop has a constant trip count the
+    /// compiler can fully unroll, and all team state lives on the
+    /// stack - no scratch vectors, no allocations. Produces the same
+    /// results as the dynamic path for the same inputs; variable
+    /// lobbies keep using ProcessMatch
+    template <std::size_t N>
+    inline void ProcessMatchFixed(FixedMatchResult<N>& match) {
+        static_assert(N > 0, "FixedMatchResult needs a nonzero team size");
+
+        // Step 1: Aggregate team statistics
+        TeamRatingStats statsA = fixedmatch_internal::ComputeTeamStats<N>(match.teamA);
+        TeamRatingStats statsB = fixedmatch_internal::ComputeTeamStats<N>(match.teamB);
+
+        // Step 2: Opponent-side terms, computed once per team
+        OpponentContext contextA = OpponentContext::FromTeamStats(statsA);
+        OpponentContext contextB = OpponentContext::FromTeamStats(statsB);
+
+        // Step 3: Performance z-scores for each team
+        std::array<double, N> zScoresA;
+        std::array<double, N> zScoresB;
+        fixedmatch_internal::ComputeZScores<N>(match.teamA, zScoresA);
+        fixedmatch_internal::ComputeZScores<N>(match.teamB, zScoresB);
+
+        // Steps 4-5: Update ratings in place
+        for (std::size_t i = 0; i < N; ++i) {
+            TeamGlicko2System::UpdatePlayerRatingInPlace(
+                match.teamA[i].rating, contextB, match.scoreA, zScoresA[i]);
+        }
+        for (std::size_t i = 0; i < N; ++i) {
+            TeamGlicko2System::UpdatePlayerRatingInPlace(
+                match.teamB[i].rating, contextA, match.scoreB, zScoresB[i]);
+        }
+    }
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_FIXEDMATCH_H_
@@ -0,0 +1,148 @@
+#ifndef GLICKO2_INCLUDE_INSTRUMENTATION_H_
+#define GLICKO2_INCLUDE_INSTRUMENTATION_H_
+
+#include <cstdint>
+#include "TeamGlicko2Config.h"
+
+#ifdef TEAMGLICKO2_INSTRUMENT
+#if !defined(__x86_64__) && !defined(__i386__)
+#include <chrono>
+#endif
+#endif
+
+namespace TeamGlicko2 {
+    /// Per-thread hot-path counters for the match processing pipeline
+    /// Filled in only when the library is built with
+    /// -DTEAMGLICKO2_INSTRUMENT (make INSTRUMENT=1); in normal builds
+    /// the recording macros below compile to nothing, so the hot path
+    /// carries zero overhead
+    /// Tick fields count rdtsc cycles on x86 and steady_clock
+    /// nanoseconds elsewhere; compare stages within one build, not
+    /// across architectures
+    struct InstrumentationCounters {
+        /// Histogram buckets cover 0..kMaxVolatilityIterations
+        static const int kVolatilityHistogramBuckets =
+            TeamGlicko2::kMaxVolatilityIterations + 1;
+
+        std::uint64_t matchesProcessed;
+
+        std::uint64_t aggregationTicks;     // Team stats + opponent contexts
+        std::uint64_t aggregationCalls;
+        std::uint64_t zScoreTicks;          // Per-team performance z-scores
+        std::uint64_t zScoreCalls;
+        std::uint64_t playerUpdateTicks;    // Per-player Glicko-2 updates
+        std::uint64_t playerUpdateCalls;
+
+        /// Illinois solver iterations, total and per-count histogram;
+        /// mass shifting toward the top buckets signals an algorithmic
+        /// tail regression long before throughput visibly drops
+        std::uint64_t volatilityIterationsTotal;
+        std::uint64_t volatilityIterationHistogram[kVolatilityHistogramBuckets];
+
+        /// Times ClampRatingChange actually limited a rating change
+        std::uint64_t clampActivations;
+
+        InstrumentationCounters() { Reset(); }
+
+        /// Zero all counters
+        void Reset() {
+            matchesProcessed = 0;
+            aggregationTicks = 0;
+            aggregationCalls = 0;
+            zScoreTicks = 0;
+            zScoreCalls = 0;
+            playerUpdateTicks = 0;
+            playerUpdateCalls = 0;
+            volatilityIterationsTotal = 0;
+            for (int i = 0; i < kVolatilityHistogramBuckets; ++i) {
+                volatilityIterationHistogram[i] = 0;
+            }
+            clampActivations = 0;
+        }
+    };
+
+    /// Access point for the per-thread counters
+    /// Exists in both build modes so exporters compile unconditionally;
+    /// without TEAMGLICKO2_INSTRUMENT the counters simply stay zero
+    class Instrumentation {
+    public:
+        /// This thread's counters; each worker accumulates privately,
+        /// so recording is a plain increment with no synchronization
+        /// Export by copying the struct from each worker thread
+        static InstrumentationCounters& ThreadCounters() {
+            static thread_local InstrumentationCounters counters;
+            return counters;
+        }
+
+#ifdef TEAMGLICKO2_INSTRUMENT
+        /// Current tick count (rdtsc cycles on x86, nanos elsewhere)
+        static std::uint64_t Now() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __builtin_ia32_rdtsc();
+#else
+            return static_cast<std::uint64_t>(
+                std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        /// Scoped timer adding elapsed ticks to one stage's counters
+        class StageTimer {
+        public:
+            StageTimer(std::uint64_t& ticks, std::uint64_t& calls)
+                : ticks(ticks), calls(calls), start(Now()) {}
+
+            ~StageTimer() {
+                ticks += Now() - start;
+                calls++;
+            }
+
+        private:
+            std::uint64_t& ticks;
+            std::uint64_t& calls;
+            std::uint64_t start;
+        };
+#endif  // TEAMGLICKO2_INSTRUMENT
+    };
+
+}  // namespace TeamGlicko2
+
+// Recording macros used inside the library; they expand to nothing
+// unless TEAMGLICKO2_INSTRUMENT is defined
+#ifdef TEAMGLICKO2_INSTRUMENT
+
+#define TEAMGLICKO2_INSTRUMENT_CONCAT_IMPL(a, b) a##b
+#define TEAMGLICKO2_INSTRUMENT_CONCAT(a, b) TEAMGLICKO2_INSTRUMENT_CONCAT_IMPL(a, b)
+
+/// Time the enclosing scope into <stage>Ticks / <stage>Calls
+#define TEAMGLICKO2_INSTRUMENT_STAGE(stage) \
+    TeamGlicko2::Instrumentation::StageTimer \
+        TEAMGLICKO2_INSTRUMENT_CONCAT(instrumentStageTimer, __LINE__)( \
+            TeamGlicko2::Instrumentation::ThreadCounters().stage##Ticks, \
+            TeamGlicko2::Instrumentation::ThreadCounters().stage##Calls)
+
+/// Add to a plain counter field
+#define TEAMGLICKO2_INSTRUMENT_ADD(field, amount) \
+    (TeamGlicko2::Instrumentation::ThreadCounters().field += (amount))
+
+/// Record one volatility solve's iteration count
+#define TEAMGLICKO2_INSTRUMENT_VOLATILITY_ITERATIONS(count) \
+    do { \
+        TeamGlicko2::InstrumentationCounters& instrumentCounters = \
+            TeamGlicko2::Instrumentation::ThreadCounters(); \
+        int instrumentBucket = (count); \
+        if (instrumentBucket >= TeamGlicko2::InstrumentationCounters::kVolatilityHistogramBuckets) { \
+            instrumentBucket = TeamGlicko2::InstrumentationCounters::kVolatilityHistogramBuckets - 1; \
+        } \
+        instrumentCounters.volatilityIterationsTotal += static_cast<std::uint64_t>(count); \
+        instrumentCounters.volatilityIterationHistogram[instrumentBucket]++; \
+    } while (0)
+
+#else
+
+#define TEAMGLICKO2_INSTRUMENT_STAGE(stage)
+#define TEAMGLICKO2_INSTRUMENT_ADD(field, amount)
+#define TEAMGLICKO2_INSTRUMENT_VOLATILITY_ITERATIONS(count)
+
+#endif  // TEAMGLICKO2_INSTRUMENT
+
+#endif  // GLICKO2_INCLUDE_INSTRUMENTATION_H_
@@ -0,0 +1,86 @@
+#ifndef GLICKO2_INCLUDE_LEADERBOARDINDEX_H_
+#define GLICKO2_INCLUDE_LEADERBOARDINDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace TeamGlicko2 {
+    /// Incrementally maintained leaderboard over Glicko-1 ratings
+    /// Replaces the copy-everything-and-sort pattern (the top-10 dump in
+    /// examples/batch_processor.cpp) with an index updated at the point
+    /// where a match result commits a new rating: call Update() with the
+    /// player's new Glicko-1 rating after ProcessMatch writes it back
+    /// Ratings are quantized into fixed-width buckets counted by a
+    /// Fenwick (binary indexed) tree, so rank queries cost O(log B) in
+    /// the bucket count B rather than O(N log N) in the player count;
+    /// exact ratings are kept per player so ordering within a bucket
+    /// stays precise
+    class LeaderboardIndex {
+    public:
+        /// One leaderboard row as returned by TopK()
+        struct Entry {
+            std::uint64_t playerId;
+            double rating;      // Glicko-1 scale
+        };
+
+        /// @param minRating Lowest indexable rating (clamped below)
+        /// @param maxRating Highest indexable rating (clamped above)
+        /// @param bucketWidth Rating points per bucket; smaller buckets
+        ///        give cheaper in-bucket scans at the cost of tree size
+        explicit LeaderboardIndex(double minRating = 0.0,
+                                  double maxRating = 4000.0,
+                                  double bucketWidth = 1.0);
+
+        /// Insert a player or move an existing player to a new rating
+        /// This is the hook point for rating writes: call it right after
+        /// a match result commits the player's updated rating
+        void Update(std::uint64_t playerId, double rating);
+
+        /// Remove a player from the index
+        /// @return true if the player was present
+        bool Remove(std::uint64_t playerId);
+
+        /// The K highest-rated players, best first
+        /// Ties and in-bucket ordering are resolved by exact rating
+        /// (descending), then by player id for determinism
+        /// Cost: O(K + log B + cost of the buckets touched)
+        std::vector<Entry> TopK(std::size_t k) const;
+
+        /// 1-based rank of a player (1 = best)
+        /// Players with equal exact rating share position by id order
+        /// @return Rank, or 0 if the player is not in the index
+        std::size_t RankOf(std::uint64_t playerId) const;
+
+        /// Number of indexed players
+        std::size_t Size() const { return ratingOf.size(); }
+
+    private:
+        /// Bucket index for a rating, clamped into range
+        std::size_t BucketOf(double rating) const;
+
+        /// Players in buckets strictly above this bucket (Fenwick prefix)
+        std::size_t CountAbove(std::size_t bucket) const;
+
+        /// Adjust the Fenwick tree count for one bucket
+        void AddToTree(std::size_t bucket, int delta);
+
+        double minRating;
+        double bucketWidth;
+        std::size_t bucketCount;
+
+        /// Fenwick tree over per-bucket player counts (1-based)
+        std::vector<int> tree;
+
+        /// Player ids per bucket, unordered; ordering is resolved on
+        /// query from the exact ratings
+        std::vector<std::vector<std::uint64_t>> buckets;
+
+        /// Exact Glicko-1 rating per indexed player
+        std::unordered_map<std::uint64_t, double> ratingOf;
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_LEADERBOARDINDEX_H_
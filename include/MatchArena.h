@@ -0,0 +1,76 @@
+#ifndef GLICKO2_INCLUDE_MATCHARENA_H_
+#define GLICKO2_INCLUDE_MATCHARENA_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "TeamGlicko2System.h"
+
+namespace TeamGlicko2 {
+    /// Bump allocator for batch match construction
+    /// High-throughput ingestion builds two small player arrays per
+    /// match; with a heap-backed MatchResult that is two mallocs per
+    /// match. The arena instead carves spans out of large blocks with a
+    /// pointer bump, and Reset() rewinds to the start while keeping the
+    /// blocks, so after the first batch has warmed the arena up,
+    /// constructing and processing the next 10k matches touches the
+    /// allocator zero times
+    /// Only trivially destructible element types are supported (spans
+    /// are abandoned wholesale on Reset, destructors never run)
+    class MatchArena {
+    public:
+        /// Default block size (1 MiB, thousands of small-match rosters)
+        static const std::size_t kDefaultBlockSize = 1u << 20;
+
+        explicit MatchArena(std::size_t blockSize = kDefaultBlockSize);
+
+        MatchArena(const MatchArena&) = delete;
+        MatchArena& operator=(const MatchArena&) = delete;
+
+        /// Allocate a default-constructed array of count elements
+        template <typename T>
+        T* AllocateArray(std::size_t count) {
+            static_assert(std::is_trivially_destructible<T>::value,
+                          "MatchArena never runs destructors");
+            T* span = static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+            for (std::size_t i = 0; i < count; ++i) {
+                new (span + i) T();
+            }
+            return span;
+        }
+
+        /// Build an arena-backed match with both rosters allocated and
+        /// default-initialized; fill in players and scores afterwards
+        ArenaMatchResult MakeMatch(std::size_t teamACount, std::size_t teamBCount);
+
+        /// Rewind the arena, invalidating every span handed out since
+        /// the last Reset; allocated blocks are kept for reuse
+        void Reset();
+
+        /// Bytes currently handed out since the last Reset
+        std::size_t BytesUsed() const;
+
+        /// Number of blocks the arena has acquired
+        std::size_t BlockCount() const { return blocks.size(); }
+
+    private:
+        /// One contiguous allocation region
+        struct Block {
+            std::vector<char> storage;
+            std::size_t used;
+
+            Block() : used(0) {}
+        };
+
+        /// Raw aligned allocation from the current block, acquiring a
+        /// new block when it does not fit
+        void* Allocate(std::size_t bytes, std::size_t alignment);
+
+        std::vector<Block> blocks;
+        std::size_t currentBlock;
+        std::size_t blockSize;
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_MATCHARENA_H_
@@ -0,0 +1,168 @@
+#ifndef GLICKO2_INCLUDE_MATCHINGESTION_H_
+#define GLICKO2_INCLUDE_MATCHINGESTION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "MatchArena.h"
+#include "RatingStore.h"
+#include "TeamGlicko2System.h"
+
+namespace TeamGlicko2 {
+    /// Interns string player ids into dense indices
+    /// Stores each distinct id once; lookups hash the raw character
+    /// range without constructing a temporary std::string, so the CSV
+    /// tokenizer can resolve ids straight out of the mapped file
+    class StringInterner {
+    public:
+        StringInterner();
+
+        /// Intern a character range, returning its dense index
+        /// The first occurrence copies the string; later occurrences
+        /// only hash and compare in place
+        std::uint32_t Intern(const char* data, std::size_t size);
+
+        /// Original string for a dense index
+        const std::string& NameOf(std::uint32_t index) const { return names[index]; }
+
+        /// Number of distinct strings interned
+        std::size_t Size() const { return names.size(); }
+
+    private:
+        /// Grow and re-seat the open-addressing table
+        void Rehash(std::size_t newTableSize);
+
+        std::vector<std::string> names;      // Dense index -> string
+        std::vector<std::uint64_t> hashes;   // Dense index -> hash (for fast compare)
+        std::vector<std::int32_t> table;     // Open-addressing slots (-1 = empty)
+    };
+
+    /// Counters describing one ingestion run
+    struct IngestionStats {
+        std::size_t matchesProcessed;   // Matches run through ProcessMatch
+        std::size_t rowsParsed;         // Data rows consumed
+        std::size_t rowsSkipped;        // Malformed or spectator rows
+        std::size_t uniquePlayers;      // Distinct player ids seen
+
+        IngestionStats()
+            : matchesProcessed(0)
+            , rowsParsed(0)
+            , rowsSkipped(0)
+            , uniquePlayers(0) {}
+    };
+
+    /// Tunables for the pipelined replay
+    struct ReplayPipelineOptions {
+        std::size_t batchMatches;      // Parsed matches per queue item
+        std::size_t queueCapacity;     // Batches in flight between stages
+        std::size_t writeBufferBytes;  // Output bytes buffered before handoff
+
+        ReplayPipelineOptions()
+            : batchMatches(256)
+            , queueCapacity(8)
+            , writeBufferBytes(1u << 20) {}
+    };
+
+    /// Streaming CSV ingestion engine for match-history replay
+    /// Maps the input file and tokenizes it in place (no per-field
+    /// string copies), interns player ids to dense RatingStore handles,
+    /// and processes each match as soon as its rows end, so memory use
+    /// is bounded by one match rather than the whole history
+    /// Expects the batch_processor column layout: MATCHID, PLAYERID,
+    /// PlayerName, TEAM (Red/Blue), KILLS, DEATH, DAMAGE, Score, Winner
+    /// Rows belonging to one match must be contiguous in the file
+    class MatchIngestion {
+    public:
+        /// Called after each processed match with the updated result
+        /// and the store handles of the two rosters (team A = Red)
+        typedef std::function<void(
+            int matchId,
+            const MatchResult& result,
+            const std::vector<PlayerHandle>& teamAHandles,
+            const std::vector<PlayerHandle>& teamBHandles)> MatchCallback;
+
+        /// Formats one processed match for the writer stage
+        /// Appended text is written verbatim (include the newlines);
+        /// runs on the compute thread, so it must not block on I/O
+        typedef std::function<void(
+            int matchId,
+            const MatchResult& result,
+            const std::vector<PlayerHandle>& teamAHandles,
+            const std::vector<PlayerHandle>& teamBHandles,
+            std::string& out)> MatchFormatter;
+
+        /// Replay a match-history CSV through the rating system
+        /// New players are added to the store with default ratings;
+        /// updated ratings are written back after each match
+        /// @param path CSV file path
+        /// @param store Rating population, updated in place
+        /// @param interner Player id interner (dense index = PlayerHandle)
+        /// @param outStats Receives counters for this run
+        /// @param callback Optional per-match hook (e.g. for output)
+        /// @return true if the file was opened and the header was valid
+        static bool Replay(
+            const std::string& path,
+            RatingStore& store,
+            StringInterner& interner,
+            IngestionStats& outStats,
+            const MatchCallback& callback = MatchCallback());
+
+        /// Parse a match-history CSV into arena-backed matches without
+        /// processing them, for feeding the ProcessMatches batch API
+        /// Rosters are spans carved from the arena (no per-match heap
+        /// allocations after warm-up) and each player's playerId is set
+        /// to its store handle, so wave scheduling sees real
+        /// dependencies; ratings embedded in the matches are the store
+        /// values at collect time
+        /// @param path CSV file path
+        /// @param store Rating population; new players are added
+        /// @param interner Player id interner (dense index = PlayerHandle)
+        /// @param arena Arena backing the rosters (not reset here)
+        /// @param outMatches Receives one entry per complete match
+        /// @param outStats Receives counters for this run
+        /// @return true if the file was opened and the header was valid
+        static bool Collect(
+            const std::string& path,
+            RatingStore& store,
+            StringInterner& interner,
+            MatchArena& arena,
+            std::vector<ArenaMatchResult>& outMatches,
+            IngestionStats& outStats);
+
+        /// Replay a match-history CSV with parsing, rating math and
+        /// output overlapped in a three-stage pipeline
+        /// The calling thread maps and parses the file, handing batches
+        /// of grouped matches over a bounded queue to a compute thread
+        /// that runs ProcessMatch and commits ratings back to the store
+        /// in file order; a writer thread drains formatted output in
+        /// large buffered writes, so end-to-end time is bounded by the
+        /// slowest stage instead of the sum of all three
+        /// Rating math stays on one thread because each match reads the
+        /// ratings the previous match wrote; for dependency-scheduled
+        /// parallel math over an already-parsed batch, use Collect with
+        /// ProcessMatches instead
+        /// Results are identical to Replay
+        /// @param path CSV file path
+        /// @param store Rating population, updated in place
+        /// @param interner Player id interner (dense index = PlayerHandle)
+        /// @param outStats Receives counters for this run
+        /// @param outputPath Output file (empty = no writer stage)
+        /// @param formatter Per-match output formatter (ignored without
+        ///                  an output path)
+        /// @param options Batch and buffer sizing
+        /// @return true if parsing succeeded and all output was written
+        static bool ReplayPipelined(
+            const std::string& path,
+            RatingStore& store,
+            StringInterner& interner,
+            IngestionStats& outStats,
+            const std::string& outputPath = std::string(),
+            const MatchFormatter& formatter = MatchFormatter(),
+            const ReplayPipelineOptions& options = ReplayPipelineOptions());
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_MATCHINGESTION_H_
@@ -0,0 +1,110 @@
+#ifndef GLICKO2_INCLUDE_MATCHMAKINGINDEX_H_
+#define GLICKO2_INCLUDE_MATCHMAKINGINDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "TeamGlickoRating.h"
+
+namespace TeamGlicko2 {
+    /// Incrementally maintained candidate index for matchmaking
+    /// Replaces the linear scan over all online players ("find ~30
+    /// players near rating R with RD below a threshold") with a grid of
+    /// effective-rating buckets crossed with RD bands, updated at the
+    /// point where a rating write commits: call Update() after
+    /// ProcessMatch writes the player back
+    /// Queries touch only the buckets adjacent to the target rating,
+    /// expanding outward until enough candidates are found, so lookup
+    /// cost scales with lobby size rather than the online population
+    class MatchmakingIndex {
+    public:
+        /// One candidate as returned by FindCandidates()
+        struct Entry {
+            std::uint64_t playerId;
+            double rating;      // Effective rating (Glicko-1 scale)
+            double rd;          // Rating deviation (Glicko-1 scale)
+        };
+
+        /// @param minRating Lowest indexable rating (clamped below)
+        /// @param maxRating Highest indexable rating (clamped above)
+        /// @param bucketWidth Rating points per bucket; also the
+        ///        quantum of the outward query expansion
+        /// @param maxRD Highest indexable rating deviation
+        /// @param rdBandWidth RD points per band; queries skip whole
+        ///        bands above their RD threshold
+        explicit MatchmakingIndex(double minRating = 0.0,
+                                  double maxRating = 4000.0,
+                                  double bucketWidth = 50.0,
+                                  double maxRD = kDefaultRD,
+                                  double rdBandWidth = 50.0);
+
+        /// Insert a player or move an existing player to new values
+        /// This is the hook point for rating writes: call it right
+        /// after a match result commits the player's updated rating
+        void Update(std::uint64_t playerId, double effectiveRating, double rd);
+
+        /// Convenience overload indexing a PlayerRating by its
+        /// effective rating and Glicko-1 RD
+        void Update(std::uint64_t playerId, const PlayerRating& rating) {
+            Update(playerId, rating.ComputeEffectiveRating(), rating.GetRD());
+        }
+
+        /// Remove a player (e.g. on logout)
+        /// @return true if the player was present
+        bool Remove(std::uint64_t playerId);
+
+        /// Up to count players nearest targetRating with rd <= maxRD,
+        /// closest first; ties resolve by player id for determinism
+        /// Scans the target bucket, then adjacent buckets outward, and
+        /// stops one ring after enough candidates are gathered so the
+        /// result is exact despite bucket quantization
+        std::vector<Entry> FindCandidates(double targetRating,
+                                          double maxRD,
+                                          std::size_t count) const;
+
+        /// Number of indexed players
+        std::size_t Size() const { return cellOf.size(); }
+
+    private:
+        /// Where one player currently lives in the grid
+        struct Cell {
+            std::size_t bucket;
+            std::size_t band;
+        };
+
+        /// Bucket index for a rating, clamped into range
+        std::size_t BucketOf(double rating) const;
+
+        /// Band index for a rating deviation, clamped into range
+        std::size_t BandOf(double rd) const;
+
+        /// Entries of one grid cell
+        std::vector<Entry>& CellEntries(std::size_t bucket, std::size_t band) {
+            return cells[bucket * bandCount + band];
+        }
+        const std::vector<Entry>& CellEntries(std::size_t bucket,
+                                              std::size_t band) const {
+            return cells[bucket * bandCount + band];
+        }
+
+        /// Append one bucket's qualifying candidates to the output
+        void GatherBucket(std::size_t bucket, std::size_t maxBand,
+                          double maxRD, std::vector<Entry>& out) const;
+
+        double minRating;
+        double bucketWidth;
+        std::size_t bucketCount;
+        double rdBandWidth;
+        std::size_t bandCount;
+
+        /// Grid of candidate entries, bucket-major
+        std::vector<std::vector<Entry>> cells;
+
+        /// Current grid cell per indexed player
+        std::unordered_map<std::uint64_t, Cell> cellOf;
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_MATCHMAKINGINDEX_H_
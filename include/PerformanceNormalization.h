@@ -1,6 +1,7 @@
 #ifndef GLICKO2_INCLUDE_PERFORMANCENORMALIZATION_H_
 #define GLICKO2_INCLUDE_PERFORMANCENORMALIZATION_H_
 
+#include <cstddef>
 #include <vector>
 #include <cmath>
 #include <algorithm>
@@ -36,6 +37,13 @@ namespace TeamGlicko2 {
         /// @return Team statistics
         static TeamPerformanceStats ComputeTeamStats(const std::vector<double>& scores);
 
+        /// Span form over a contiguous score buffer; the vector
+        /// overload delegates here
+        /// @param scores Pointer to the first score
+        /// @param n Number of players
+        /// @return Team statistics
+        static TeamPerformanceStats ComputeTeamStats(const double* scores, std::size_t n);
+
         /// Normalize performance scores within a team
         /// Converts raw scores to z-scores (standard deviations from team mean)
         /// @param scores Raw performance scores for each player
@@ -45,6 +53,28 @@ namespace TeamGlicko2 {
             const std::vector<double>& scores,
             double maxZScore = TeamGlicko2::kMaxPerfZScore);
 
+        /// Normalize performance scores into a caller-provided buffer
+        /// Reuses the buffer's capacity, so steady-state callers perform
+        /// no heap allocations
+        /// @param scores Raw performance scores for each player
+        /// @param outResults Output buffer, resized to the team size
+        /// @param maxZScore Maximum z-score clipping (default from config)
+        static void NormalizeTeamPerformance(
+            const std::vector<double>& scores,
+            std::vector<PlayerPerformance>& outResults,
+            double maxZScore = TeamGlicko2::kMaxPerfZScore);
+
+        /// Span form of the buffer overload above
+        /// @param scores Pointer to the first score
+        /// @param n Number of players
+        /// @param outResults Output buffer, resized to the team size
+        /// @param maxZScore Maximum z-score clipping (default from config)
+        static void NormalizeTeamPerformance(
+            const double* scores,
+            std::size_t n,
+            std::vector<PlayerPerformance>& outResults,
+            double maxZScore = TeamGlicko2::kMaxPerfZScore);
+
         /// Compute z-score for a single value given team stats
         /// @param score Raw performance score
         /// @param stats Team performance statistics
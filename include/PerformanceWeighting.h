@@ -1,6 +1,7 @@
 #ifndef GLICKO2_INCLUDE_PERFORMANCEWEIGHTING_H_
 #define GLICKO2_INCLUDE_PERFORMANCEWEIGHTING_H_
 
+#include <cstddef>
 #include <vector>
 #include <cmath>
 #include "TeamGlicko2Config.h"
@@ -27,6 +28,25 @@ namespace TeamGlicko2 {
         static std::vector<PlayerWeight> ComputeZScores(
             const std::vector<double>& performanceScores);
 
+        /// Compute z-scores into a caller-provided buffer
+        /// Reuses the buffer's capacity, so steady-state callers perform
+        /// no heap allocations
+        /// @param performanceScores Raw performance scores for each player
+        /// @param outWeights Output buffer, resized to the team size
+        static void ComputeZScores(
+            const std::vector<double>& performanceScores,
+            std::vector<PlayerWeight>& outWeights);
+
+        /// Span form over a contiguous score buffer (e.g. a scratch
+        /// column); the vector overloads delegate here
+        /// @param performanceScores Pointer to the first score
+        /// @param n Number of players
+        /// @param outWeights Output buffer, resized to the team size
+        static void ComputeZScores(
+            const double* performanceScores,
+            std::size_t n,
+            std::vector<PlayerWeight>& outWeights);
+
         /// Compute sign-aware scaling factor for rating adjustment
         /// f_i = 1 + β·sign(Δμ)·z_i, clamped to [fMin, fMax]
         /// @param zScore Performance z-score relative to teammates
@@ -0,0 +1,141 @@
+#ifndef GLICKO2_INCLUDE_RATINGDELTALOG_H_
+#define GLICKO2_INCLUDE_RATINGDELTALOG_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "TeamGlickoRating.h"
+
+namespace TeamGlicko2 {
+    /// Fixed-size on-disk record for one player's rating change
+    /// prevOffset chains each record to the same player's previous one,
+    /// so a single player's trajectory is reconstructed by walking the
+    /// chain backward instead of scanning the whole log
+    /// Field order and widths are part of the format; new fields must
+    /// go at the end together with a version bump
+    struct DeltaRecord {
+        std::uint64_t matchId;      // Match that produced this change
+        std::uint64_t playerId;     // External player identifier
+        std::int64_t prevOffset;    // File offset of this player's previous record (-1 = first)
+        double muBefore;            // Rating before the match (Glicko-2 scale)
+        double phiBefore;           // Deviation before the match
+        double sigmaBefore;         // Volatility before the match
+        double muAfter;             // Rating after the match
+        double phiAfter;            // Deviation after the match
+        double sigmaAfter;          // Volatility after the match
+    };
+
+    static_assert(sizeof(DeltaRecord) == 72,
+                  "DeltaRecord must stay a fixed 72-byte on-disk record");
+
+    /// Append-only binary log of per-player rating deltas
+    /// The audit-replay path for "what was player X's trajectory":
+    /// instead of re-running the full match CSV, each processed match
+    /// appends one record per player (before and after state), and a
+    /// reader follows that player's prevOffset chain through a mapped
+    /// view of the file - milliseconds per player instead of a global
+    /// rerun
+    /// Typical write-side usage around a match:
+    ///     capture each player's rating, call ProcessMatch, then
+    ///     writer.Append(matchId, playerId, before, player.rating)
+    class RatingDeltaLog {
+    public:
+        /// Current format version
+        static const std::uint32_t kFormatVersion = 1;
+
+        /// Buffered appender maintaining the per-player chains
+        /// Records are staged in memory and written in groups, so the
+        /// hot path is an in-memory copy; Close() writes a side index
+        /// of chain tails next to the log (<path>.idx) so readers can
+        /// skip the initial full scan
+        class Writer {
+        public:
+            Writer();
+            ~Writer();
+
+            Writer(const Writer&) = delete;
+            Writer& operator=(const Writer&) = delete;
+
+            /// Open or create a log; an existing log is appended to
+            /// (its chain tails are rebuilt with one scan)
+            bool Open(const std::string& path);
+
+            /// Append one player's delta for one match
+            bool Append(
+                std::uint64_t matchId,
+                std::uint64_t playerId,
+                const PlayerRating& before,
+                const PlayerRating& after);
+
+            /// Write all buffered records to the file
+            bool Flush();
+
+            /// Flush, write the side index and close the file
+            bool Close();
+
+            /// Whether a log is currently open
+            bool IsOpen() const { return file != nullptr; }
+
+        private:
+            std::FILE* file;
+            std::string path;
+            std::uint64_t endOffset;        // Next record's file offset (incl. buffered)
+            std::vector<DeltaRecord> chunk;
+            std::unordered_map<std::uint64_t, std::int64_t> tailOffsets;
+        };
+
+        /// Memory-mapped reader over a closed (or flushed) log
+        /// Uses the side index when present and matching, otherwise
+        /// rebuilds the chain tails with one sequential scan
+        class Reader {
+        public:
+            Reader();
+            ~Reader();
+
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+            /// Map the log file; returns false on I/O or format errors
+            bool Open(const std::string& path);
+
+            /// Release the mapping
+            void Close();
+
+            /// Whether a log is currently mapped
+            bool IsOpen() const { return base != nullptr; }
+
+            /// Number of records in the log
+            std::size_t Count() const { return recordCount; }
+
+            /// Access one record in place
+            const DeltaRecord& Record(std::size_t index) const;
+
+            /// Reconstruct one player's full trajectory, oldest first
+            /// Walks the player's chain backward from its tail; cost is
+            /// proportional to that player's match count only
+            /// @return true if the player has at least one record
+            bool History(std::uint64_t playerId, std::vector<DeltaRecord>& out) const;
+
+        private:
+            const char* base;
+            std::size_t fileSize;
+            std::size_t recordCount;
+            void* mapping;              // mmap base (null when using the fallback)
+            std::vector<char> fallbackBuffer;  // Used when mmap is unavailable
+            std::unordered_map<std::uint64_t, std::int64_t> tailOffsets;
+        };
+
+        /// Rewrite a log with each player's chain laid out contiguously
+        /// in chronological order (prevOffset chains rebuilt), so that
+        /// replaying one player becomes a sequential read instead of a
+        /// backward walk through the whole file
+        /// Also writes a fresh side index for the output
+        static bool Compact(const std::string& inputPath, const std::string& outputPath);
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_RATINGDELTALOG_H_
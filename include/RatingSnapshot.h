@@ -0,0 +1,102 @@
+#ifndef GLICKO2_INCLUDE_RATINGSNAPSHOT_H_
+#define GLICKO2_INCLUDE_RATINGSNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "RatingStore.h"
+
+namespace TeamGlicko2 {
+    /// Fixed-size on-disk record for one player
+    /// Field order and widths are part of the format; new fields must
+    /// go at the end together with a version bump
+    struct SnapshotRecord {
+        std::uint64_t playerId;     // External player identifier
+        double mu;                  // Rating (Glicko-2 scale)
+        double phi;                 // Rating deviation (Glicko-2 scale)
+        double sigma;               // Volatility
+        double perfIndexEMA;        // Recent performance index
+        std::int32_t perfGames;     // Performance game count
+        std::int32_t reserved;      // Padding, written as zero
+    };
+
+    static_assert(sizeof(SnapshotRecord) == 48,
+                  "SnapshotRecord must stay a fixed 48-byte on-disk record");
+
+    /// On-disk file header preceding the record array
+    struct SnapshotHeader {
+        std::uint32_t magic;        // 'TGRS'
+        std::uint32_t version;      // Format version
+        std::uint64_t recordCount;  // Number of SnapshotRecords that follow
+    };
+
+    /// Versioned binary snapshot of a full rating population
+    /// Writing streams the records in one buffered pass; loading maps
+    /// the file and reads records in place, so service cold-start is
+    /// bounded by page faults rather than text parsing
+    class RatingSnapshot {
+    public:
+        /// Current format version
+        static const std::uint32_t kFormatVersion = 1;
+
+        /// Write a snapshot of a RatingStore
+        /// @param path Output file path (overwritten)
+        /// @param store Rating population to snapshot
+        /// @param playerIds External id per handle, parallel to the store
+        /// @return true on success
+        static bool Write(
+            const std::string& path,
+            const RatingStore& store,
+            const std::vector<std::uint64_t>& playerIds);
+
+        /// Load a snapshot into a RatingStore
+        /// Handles are assigned densely in record order
+        /// @param path Snapshot file path
+        /// @param store Receives the population (cleared first)
+        /// @param outPlayerIds Receives the external id per handle
+        /// @return true on success
+        static bool Load(
+            const std::string& path,
+            RatingStore& store,
+            std::vector<std::uint64_t>& outPlayerIds);
+
+        /// Memory-mapped read-only view over a snapshot file
+        /// Records are accessed directly in the mapping without any
+        /// per-record parsing or copying; on platforms without mmap the
+        /// view falls back to reading the file into memory
+        class View {
+        public:
+            View();
+            ~View();
+
+            View(const View&) = delete;
+            View& operator=(const View&) = delete;
+
+            /// Map the snapshot file; returns false on I/O or format errors
+            bool Open(const std::string& path);
+
+            /// Release the mapping
+            void Close();
+
+            /// Whether a snapshot is currently mapped
+            bool IsOpen() const { return records != nullptr; }
+
+            /// Number of records in the snapshot
+            std::size_t Count() const { return recordCount; }
+
+            /// Access one record in place
+            const SnapshotRecord& Record(std::size_t index) const { return records[index]; }
+
+        private:
+            const SnapshotRecord* records;
+            std::size_t recordCount;
+            void* mapping;              // mmap base (null when using the fallback)
+            std::size_t mappingSize;
+            std::vector<char> fallbackBuffer;  // Used when mmap is unavailable
+        };
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_RATINGSNAPSHOT_H_
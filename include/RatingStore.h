@@ -0,0 +1,138 @@
+#ifndef GLICKO2_INCLUDE_RATINGSTORE_H_
+#define GLICKO2_INCLUDE_RATINGSTORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "TeamGlickoRating.h"
+#include "TeamGlicko2Config.h"
+
+namespace TeamGlicko2 {
+    /// Per-player activity inputs for a population decay sweep
+    /// Mirrors the arguments of PlayerRating::DecayForInactivity
+    struct ActivityInfo {
+        int roundsInPastDays;   // Rounds played in the past D days
+        double deltaDays;       // Days since last match
+
+        ActivityInfo() : roundsInPastDays(0), deltaDays(0.0) {}
+        ActivityInfo(int rounds, double days)
+            : roundsInPastDays(rounds), deltaDays(days) {}
+    };
+
+    /// Dense handle identifying a player slot in a RatingStore
+    typedef std::uint32_t PlayerHandle;
+
+    /// Sentinel for "no such player"
+    static const PlayerHandle kInvalidPlayerHandle = 0xFFFFFFFFu;
+
+    /// Structure-of-arrays store for a full rating population
+    /// Each PlayerRating field lives in its own contiguous column
+    /// (mu, phi, sigma, perfIndexEMA, perfGames) indexed by a dense
+    /// PlayerHandle, so population-wide passes — leaderboard scans,
+    /// decay sweeps, team aggregation — are cache-linear array walks
+    /// instead of pointer-chasing through per-player objects
+    /// PlayerRating remains the per-player view type: Get() materializes
+    /// one and Set() writes one back
+    class RatingStore {
+    public:
+        /// Add a player with default initial rating values
+        /// @return Handle for the new player slot
+        PlayerHandle Add();
+
+        /// Add a player with an existing rating state
+        /// @param rating Rating state to copy into the columns
+        /// @return Handle for the new player slot
+        PlayerHandle Add(const PlayerRating& rating);
+
+        /// Number of player slots in the store
+        std::size_t Size() const { return mu.size(); }
+
+        /// Reserve capacity for an expected population size
+        void Reserve(std::size_t capacity);
+
+        /// Remove all players
+        void Clear();
+
+        /// Materialize a PlayerRating view of one player slot
+        PlayerRating Get(PlayerHandle handle) const;
+
+        /// Write a PlayerRating back into the columns
+        void Set(PlayerHandle handle, const PlayerRating& rating);
+
+        // ========== Per-Field Accessors (Glicko-2 scale) ==========
+
+        double GetMu(PlayerHandle handle) const { return mu[handle]; }
+        double GetPhi(PlayerHandle handle) const { return phi[handle]; }
+        double GetSigma(PlayerHandle handle) const { return sigma[handle]; }
+        double GetPerfIndexEMA(PlayerHandle handle) const { return perfIndexEMA[handle]; }
+        int GetPerfGames(PlayerHandle handle) const { return perfGames[handle]; }
+
+        void SetMu(PlayerHandle handle, double value) { mu[handle] = value; }
+        void SetPhi(PlayerHandle handle, double value) { phi[handle] = value; }
+        void SetSigma(PlayerHandle handle, double value) { sigma[handle] = value; }
+        void SetPerfIndexEMA(PlayerHandle handle, double value) { perfIndexEMA[handle] = value; }
+        void SetPerfGames(PlayerHandle handle, int value) { perfGames[handle] = value; }
+
+        // ========== Derived Values (Glicko-1 scale) ==========
+
+        /// Rating in Glicko-1 scale for one slot
+        double GetRating(PlayerHandle handle) const {
+            return mu[handle] * TeamGlicko2::kScale + TeamGlicko2::kDefaultRating;
+        }
+
+        /// Rating deviation in Glicko-1 scale for one slot
+        double GetRD(PlayerHandle handle) const {
+            return phi[handle] * TeamGlicko2::kScale;
+        }
+
+        // ========== Bulk Operations ==========
+
+        /// Apply inactivity decay to the whole population in one pass
+        /// Walks the contiguous phi/sigma columns directly - the same
+        /// decay rule as PlayerRating::DecayForInactivity, but without
+        /// going through per-player objects - and splits the range
+        /// across worker threads
+        /// Players already at kMaxRD or considered active are skipped
+        /// @param activity Per-player activity info, parallel to handles
+        /// @param n Number of entries in activity (must equal Size())
+        /// @param numThreads Worker threads for the sweep (0 or 1 = serial)
+        /// @return Number of players whose RD was actually increased
+        std::size_t DecaySweep(const ActivityInfo* activity, std::size_t n,
+                               std::size_t numThreads = 1);
+
+        // ========== Raw Column Access ==========
+        // Contiguous arrays of Size() elements, for bulk passes and
+        // vectorized kernels
+
+        const double* MuData() const { return mu.data(); }
+        const double* PhiData() const { return phi.data(); }
+        const double* SigmaData() const { return sigma.data(); }
+        const double* PerfIndexEMAData() const { return perfIndexEMA.data(); }
+        const int* PerfGamesData() const { return perfGames.data(); }
+
+        double* MuData() { return mu.data(); }
+        double* PhiData() { return phi.data(); }
+        double* SigmaData() { return sigma.data(); }
+        double* PerfIndexEMAData() { return perfIndexEMA.data(); }
+        int* PerfGamesData() { return perfGames.data(); }
+
+    private:
+        /// Internal rating column (Glicko-2 scale)
+        std::vector<double> mu;
+
+        /// Internal rating deviation column (Glicko-2 scale)
+        std::vector<double> phi;
+
+        /// Rating volatility column
+        std::vector<double> sigma;
+
+        /// Recent performance index column (EMA of z-scores)
+        std::vector<double> perfIndexEMA;
+
+        /// Performance game count column
+        std::vector<int> perfGames;
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_RATINGSTORE_H_
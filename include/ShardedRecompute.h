@@ -0,0 +1,106 @@
+#ifndef GLICKO2_INCLUDE_SHARDEDRECOMPUTE_H_
+#define GLICKO2_INCLUDE_SHARDEDRECOMPUTE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "RatingStore.h"
+#include "TeamGlicko2System.h"
+#include "TeamRatingAggregator.h"
+
+namespace TeamGlicko2 {
+    /// Building blocks for recomputing a rating history across K
+    /// independent shards (processes or machines)
+    /// Players are assigned to shards by id hash. Matches whose rosters
+    /// live on one shard are processed there with the normal pipeline.
+    /// Cross-shard matches run in two phases: each shard publishes its
+    /// partial TeamRatingStats for the roster members it owns (phase
+    /// one), the partials are combined into the full team aggregates,
+    /// and each shard then updates only its own players against the
+    /// combined opponent stats (phase two). Afterwards each shard
+    /// writes a RatingSnapshot and MergeShardSnapshots() folds them
+    /// into one store, taking each player from the shard that owns it
+    /// The transport between shards is the caller's concern; this class
+    /// only defines the stable partitioning, the exchanged aggregates
+    /// and the merge
+    class ShardedRecompute {
+    public:
+        /// Stable shard assignment for a player id
+        /// Uses a mixed hash rather than a modulo of the raw id, so
+        /// sequential id ranges spread evenly across shards
+        static std::size_t ShardOf(std::uint64_t playerId, std::size_t shardCount);
+
+        /// Split a match list into per-shard local work and the
+        /// cross-shard remainder
+        /// @param matches Full match history, in chronological order
+        /// @param shardCount Number of shards K
+        /// @param outLocalMatches outLocalMatches[s] receives the
+        ///        indices of matches whose rosters are entirely on s
+        /// @param outCrossMatches Receives the indices of matches that
+        ///        span shards, in order
+        static void PartitionMatches(
+            const std::vector<MatchResult>& matches,
+            std::size_t shardCount,
+            std::vector<std::vector<std::size_t>>& outLocalMatches,
+            std::vector<std::size_t>& outCrossMatches);
+
+        /// Phase one: this shard's partial aggregate of one roster
+        /// Only members owned by the shard contribute; the result's
+        /// teamSize carries the contribution count for CombineTeamStats
+        /// @param team Roster span
+        /// @param n Roster size
+        /// @param shard This shard's index
+        /// @param shardCount Number of shards K
+        /// @return Partial stats (teamSize 0 when no member is owned)
+        static TeamRatingStats ComputePartialTeamStats(
+            const MatchPlayer* team, std::size_t n,
+            std::size_t shard, std::size_t shardCount);
+
+        /// Combine per-shard partial aggregates into full team stats
+        /// Inverts the mean/root-mean-square forms back to sums using
+        /// each partial's teamSize, so the combination is independent
+        /// of how members were split across shards
+        /// @param partials One partial per shard (empty ones allowed)
+        /// @param count Number of partials
+        /// @return Aggregated stats over all contributing members
+        static TeamRatingStats CombineTeamStats(
+            const TeamRatingStats* partials, std::size_t count);
+
+        /// Phase two: update this shard's players of a cross-shard match
+        /// Performance z-scores are computed over the full rosters (the
+        /// match rows are replicated to every shard; only the rating
+        /// state is remote), then ratings are written in place for the
+        /// players this shard owns
+        /// @param match Match with full rosters; owned players' ratings
+        ///        must be current, remote ones may be stale
+        /// @param statsA Combined aggregate for team A
+        /// @param statsB Combined aggregate for team B
+        /// @param shard This shard's index
+        /// @param shardCount Number of shards K
+        /// @param scratch Reusable buffers
+        static void ProcessCrossShardMatch(
+            MatchResult& match,
+            const TeamRatingStats& statsA,
+            const TeamRatingStats& statsB,
+            std::size_t shard,
+            std::size_t shardCount,
+            MatchScratch& scratch);
+
+        /// Merge shard-local snapshots into one population
+        /// paths[s] must be the RatingSnapshot written by shard s; each
+        /// player is taken from the shard that owns it, so stale ghost
+        /// entries for remote players are dropped
+        /// @param paths One snapshot path per shard, indexed by shard
+        /// @param outStore Receives the merged population (cleared first)
+        /// @param outPlayerIds Receives the external id per handle
+        /// @return true if every snapshot loaded successfully
+        static bool MergeShardSnapshots(
+            const std::vector<std::string>& paths,
+            RatingStore& outStore,
+            std::vector<std::uint64_t>& outPlayerIds);
+    };
+
+}  // namespace TeamGlicko2
+
+#endif  // GLICKO2_INCLUDE_SHARDEDRECOMPUTE_H_
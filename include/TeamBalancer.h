@@ -4,6 +4,8 @@
 #include <vector>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <limits>
 #include "TeamGlickoRating.h"
 
@@ -46,6 +48,21 @@ namespace TeamGlicko2 {
             , pureRatingDifference(0.0) {}
     };
 
+    /// Counters describing one BalanceTeams run
+    /// Returned to the caller instead of being written to a stream, so
+    /// balancing threads perform no I/O; feed these to your metrics
+    /// pipeline from wherever the assignment is consumed
+    struct BalancerStats {
+        int combinationsTried;      // Complete team selections evaluated
+        int combinationsPruned;     // Subtrees cut by the bound check
+        std::int64_t elapsedNanos;  // Wall time of the search
+
+        BalancerStats()
+            : combinationsTried(0)
+            , combinationsPruned(0)
+            , elapsedNanos(0) {}
+    };
+
     /// Configuration for team balancing algorithm
     struct BalancerConfig {
         /// Lambda: Team uncertainty balance weight
@@ -71,6 +88,12 @@ namespace TeamGlicko2 {
         /// 14 players = 252 combinations (acceptable)
         int maxCombinationsToTry;
 
+        /// Optional stats sink invoked once per BalanceTeams call with
+        /// the run's BalancerStats; leave empty for no reporting
+        /// The callback runs on the balancing thread, so it should only
+        /// hand the struct off (e.g. push to a metrics queue), not do I/O
+        std::function<void(const BalancerStats&)> statsSink;
+
         BalancerConfig()
             : lambda(TeamGlicko2::kLambda)
             , separateTopPlayers(true)
@@ -90,6 +113,29 @@ namespace TeamGlicko2 {
             const std::vector<PlayerInfo>& players,
             const BalancerConfig& config = BalancerConfig());
 
+        /// Balance players into two teams and report search statistics
+        /// @param players Vector of all players to balance
+        /// @param config Balancing configuration parameters
+        /// @param outStats Receives counters and timing for this run
+        /// @return Optimal team assignment
+        static TeamAssignment BalanceTeams(
+            const std::vector<PlayerInfo>& players,
+            const BalancerConfig& config,
+            BalancerStats& outStats);
+
+        /// Balance a lobby the caller no longer needs
+        /// Sorts the moved-in vector in place instead of copying it;
+        /// the lvalue overloads delegate here after making their copy
+        static TeamAssignment BalanceTeams(
+            std::vector<PlayerInfo>&& players,
+            const BalancerConfig& config = BalancerConfig());
+
+        /// Rvalue form with search statistics
+        static TeamAssignment BalanceTeams(
+            std::vector<PlayerInfo>&& players,
+            const BalancerConfig& config,
+            BalancerStats& outStats);
+
         /// Calculate team strength (sum of effective ratings)
         /// Returns sum of R_eff for all players in the team
         static double CalculateTeamStrength(
@@ -129,15 +175,46 @@ namespace TeamGlicko2 {
             const std::vector<int>& teamIndices);
 
     private:
-        /// Recursive helper for trying all valid team combinations
-        static void GenerateCombinations(
-            const std::vector<PlayerInfo>& players,
-            const BalancerConfig& config,
-            int teamSize,
+        /// Search state for the branch-and-bound combination search
+        /// Running sums are maintained incrementally as players are
+        /// added to / removed from team 0, so leaf evaluation is O(1)
+        struct SearchContext {
+            const std::vector<PlayerInfo>* players;  // Sorted by effective rating (desc)
+            const BalancerConfig* config;
+            int teamSize;              // Target size of team 0
+            int totalPlayers;
+            double totalEffective;     // Sum of effective ratings, all players
+            double totalRDSquared;     // Sum of RD^2, all players
+            double totalPureRating;    // Sum of pure ratings, all players
+            std::vector<double> effectivePrefix;  // Prefix sums of effective rating
+            std::vector<int> currentTeam0;
+            double team0Effective;     // Running sum of team 0 effective ratings
+            double team0RDSquared;     // Running sum of team 0 RD^2
+            double team0PureRating;    // Running sum of team 0 pure ratings
+            bool team0HasTop1;         // Team 0 contains sorted index 0
+            bool team0HasTop2;         // Team 0 contains sorted index 1
+            int combinationsTried;
+            int combinationsPruned;    // Subtrees cut by the bound check
+        };
+
+        /// Branch-and-bound search over team 0 selections
+        /// Prunes any subtree whose best-case strength difference already
+        /// exceeds the incumbent objective, which keeps 16-20 player
+        /// lobbies exact and fast
+        static void BranchAndBound(
+            SearchContext& context,
             int startIndex,
-            std::vector<int>& currentTeam0,
-            TeamAssignment& bestAssignment,
-            int& combinationsTried);
+            TeamAssignment& bestAssignment);
+
+        /// Lower bound on the strength-difference term for any completion
+        /// of the current partial team 0 using players from [startIndex, N)
+        /// Since the uncertainty term is non-negative, this also bounds
+        /// the full objective from below
+        static double StrengthLowerBound(const SearchContext& context, int startIndex);
+
+        /// Evaluate a complete team 0 selection from the running sums
+        /// and update the incumbent if it is better
+        static void EvaluateLeaf(SearchContext& context, TeamAssignment& bestAssignment);
 
         /// Create a team assignment from team 0 indices
         /// Team 1 is implicitly all remaining players
@@ -29,8 +29,22 @@ namespace TeamGlicko2 {
     static const double kTau = 0.5;
 
     /// Convergence tolerance for volatility update (epsilon)
+    /// Raise this (e.g. to 1e-4) to trade a little precision for fewer
+    /// solver iterations on latency-sensitive paths
     static const double kConvergence = 0.000001;
 
+    /// Hard cap on Illinois iterations in the volatility update
+    /// Typical matches converge in under 10 iterations; the cap bounds
+    /// the worst-case latency of a single player update, returning the
+    /// current bracket midpoint estimate if it is ever reached
+    static const int kMaxVolatilityIterations = 30;
+
+    /// Hard cap on downward bracketing steps when delta^2 <= phi^2 + v
+    /// Each step widens the bracket by tau; 60 steps covers sigma
+    /// shrinking by a factor of e^-30 from its starting point, far past
+    /// anything reachable from valid inputs
+    static const int kMaxVolatilityBracketSteps = 60;
+
 
     // ========== Performance Weighting Parameters ==========
 
@@ -126,6 +140,39 @@ namespace TeamGlicko2 {
     /// Maximum z-score clipping for performance index
     /// Prevents extreme outliers from dominating the calculation
     static const double kMaxPerfZScore = 3.0;
+
+
+    // ========== Runtime Configuration ==========
+
+    /// Runtime-tunable copy of the update-path parameters
+    /// Pass one of these to the ProcessMatch / UpdatePlayerRating
+    /// overloads that accept it to run experiments (per-title tuning,
+    /// A/B parameter sets) without rebuilding; the overloads without a
+    /// config keep using the compile-time constants above, so the
+    /// default path still constant-folds (e.g. the rating-clamp branch
+    /// disappears entirely when kEnableRatingClamp is false)
+    struct Glicko2Config {
+        double tau;                     // System constant (volatility change rate)
+        double convergence;             // Volatility solver tolerance
+        int maxVolatilityIterations;    // Illinois iteration cap
+        int maxVolatilityBracketSteps;  // Bracketing walk cap
+        double beta;                    // Performance scaling sensitivity
+        double scaleMin;                // Minimum performance scaling factor
+        double scaleMax;                // Maximum performance scaling factor
+        bool enableRatingClamp;         // Whether to clamp rating changes
+        double maxRatingChange;         // Clamp bound (Glicko-2 scale)
+
+        Glicko2Config()
+            : tau(kTau)
+            , convergence(kConvergence)
+            , maxVolatilityIterations(kMaxVolatilityIterations)
+            , maxVolatilityBracketSteps(kMaxVolatilityBracketSteps)
+            , beta(kBeta)
+            , scaleMin(kScaleMin)
+            , scaleMax(kScaleMax)
+            , enableRatingClamp(kEnableRatingClamp)
+            , maxRatingChange(kMaxRatingChange) {}
+    };
 }  // namespace TeamGlicko2
 
 #endif  // GLICKO2_INCLUDE_TEAMGLICKO2CONFIG_H_
@@ -13,10 +13,13 @@ namespace TeamGlicko2 {
     struct MatchPlayer {
         PlayerRating rating;         // Current rating state
         double performanceScore;     // Performance score for this match
+        int playerId;                // Unique player identifier (-1 = unknown)
 
-        MatchPlayer() : performanceScore(0.0) {}
+        MatchPlayer() : performanceScore(0.0), playerId(-1) {}
         MatchPlayer(const PlayerRating& r, double perf)
-            : rating(r), performanceScore(perf) {}
+            : rating(r), performanceScore(perf), playerId(-1) {}
+        MatchPlayer(const PlayerRating& r, double perf, int id)
+            : rating(r), performanceScore(perf), playerId(id) {}
     };
 
     /// Represents the outcome of a match between two teams
@@ -29,6 +32,112 @@ namespace TeamGlicko2 {
         MatchResult() : scoreA(0.0), scoreB(0.0) {}
     };
 
+    /// Outcome of a match between an arbitrary number of teams
+    /// Covers N-team modes (domination, free-for-all with one-player
+    /// teams) natively instead of synthesizing pairwise MatchResults:
+    /// one call aggregates each team and normalizes each roster exactly
+    /// once, then reuses those across all opponent pairings
+    struct MultiMatchResult {
+        std::vector<std::vector<MatchPlayer>> teams;  // One roster per team
+        std::vector<double> placements;               // Finish per team; lower = better
+
+        /// Pairwise score for team i against team j derived from
+        /// placements (1.0 = beat them, 0.5 = tied, 0.0 = lost)
+        double ScoreAgainst(size_t i, size_t j) const {
+            if (placements[i] < placements[j]) return TeamGlicko2::kWinScore;
+            if (placements[i] > placements[j]) return TeamGlicko2::kLossScore;
+            return TeamGlicko2::kDrawScore;
+        }
+    };
+
+    /// Match between two teams stored as raw spans instead of vectors
+    /// The player arrays typically live in a MatchArena, so building
+    /// ten thousand of these between arena resets performs no heap
+    /// allocations; processing semantics are identical to MatchResult
+    struct ArenaMatchResult {
+        MatchPlayer* teamA;         // Team A players (arena-backed span)
+        std::size_t teamACount;
+        MatchPlayer* teamB;         // Team B players (arena-backed span)
+        std::size_t teamBCount;
+        double scoreA;              // Match score for team A
+        double scoreB;              // Match score for team B
+
+        ArenaMatchResult()
+            : teamA(nullptr), teamACount(0)
+            , teamB(nullptr), teamBCount(0)
+            , scoreA(0.0), scoreB(0.0) {}
+    };
+
+    /// Reusable workspace for ProcessMatch
+    /// Holding one of these across calls lets steady-state match
+    /// processing run without any heap allocations: the vectors keep
+    /// their capacity between matches
+    struct MatchScratch {
+        std::vector<double> teamAMu;       // Rating column per team, gathered
+        std::vector<double> teamAPhi;      // once so aggregation reduces
+        std::vector<double> teamBMu;       // dense arrays
+        std::vector<double> teamBPhi;
+        std::vector<double> teamAPerformance;
+        std::vector<double> teamBPerformance;
+        std::vector<PlayerWeight> weightsA;
+        std::vector<PlayerWeight> weightsB;
+
+        /// Clear contents while keeping allocated capacity
+        void Clear() {
+            teamAMu.clear();
+            teamAPhi.clear();
+            teamBMu.clear();
+            teamBPhi.clear();
+            teamAPerformance.clear();
+            teamBPerformance.clear();
+            weightsA.clear();
+            weightsB.clear();
+        }
+    };
+
+    /// Precomputed opponent-side terms shared by every player update
+    /// against the same team
+    /// All players on a team face the identical opponent aggregate, so
+    /// g(phi_opp) is computed once per team instead of once per player
+    struct OpponentContext {
+        double mu;    // Opposing team's aggregated mu
+        double phi;   // Opposing team's aggregated phi
+        double g;     // g(phi) for the aggregated phi
+
+        OpponentContext() : mu(0.0), phi(0.0), g(1.0) {}
+
+        /// Build the context from aggregated team stats, computing
+        /// g(phi) once
+        static OpponentContext FromTeamStats(const TeamRatingStats& stats);
+    };
+
+    /// Reusable workspace for ProcessMultiMatch
+    /// Per-team results are kept across the whole match so each team's
+    /// aggregate and z-scores are computed once and reused against
+    /// every opponent pairing
+    struct MultiMatchScratch {
+        std::vector<double> teamMu;                       // Refilled per team
+        std::vector<double> teamPhi;                      // Refilled per team
+        std::vector<double> teamPerformance;              // Refilled per team
+        std::vector<OpponentContext> contexts;            // One per team
+        std::vector<std::vector<PlayerWeight>> weights;   // One per team
+        std::vector<OpponentContext> opponents;           // Pairing scratch
+        std::vector<double> scores;                       // Pairing scratch
+
+        /// Clear contents while keeping allocated capacity
+        void Clear() {
+            teamMu.clear();
+            teamPhi.clear();
+            teamPerformance.clear();
+            contexts.clear();
+            for (auto& w : weights) {
+                w.clear();
+            }
+            opponents.clear();
+            scores.clear();
+        }
+    };
+
     /// Main system for processing team-based Glicko-2 rating updates
     /// Implements the full algorithm from Section 8 of the specification
     class TeamGlicko2System {
@@ -38,6 +147,64 @@ namespace TeamGlicko2 {
         /// This function modifies the rating member of each MatchPlayer in place
         static void ProcessMatch(MatchResult& match);
 
+        /// Process a match using a caller-provided scratch workspace
+        /// Behaves identically to ProcessMatch(match) but reuses the
+        /// workspace buffers, so no heap allocations occur once the
+        /// scratch has warmed up to the largest team size seen
+        /// @param match Match result with player ratings and performance scores
+        /// @param scratch Reusable workspace (typically one per worker thread)
+        static void ProcessMatch(MatchResult& match, MatchScratch& scratch);
+
+        /// Process an arena-backed match
+        /// Identical algorithm to ProcessMatch(match, scratch); ratings
+        /// are updated in place inside the spans
+        /// @param match Span-backed match (see MatchArena)
+        /// @param scratch Reusable workspace (typically one per worker thread)
+        static void ProcessMatch(ArenaMatchResult& match, MatchScratch& scratch);
+
+        /// Process a match under a runtime parameter set
+        /// Identical to ProcessMatch(match, scratch) except the update
+        /// parameters (tau, beta, clamp, ...) come from the supplied
+        /// config instead of the compile-time constants; use this for
+        /// tuning experiments that swap parameter sets without a rebuild
+        /// @param match Match result with player ratings and performance scores
+        /// @param scratch Reusable workspace (typically one per worker thread)
+        /// @param config Runtime update parameters
+        static void ProcessMatch(MatchResult& match, MatchScratch& scratch,
+                                 const Glicko2Config& config);
+
+        /// Process a multi-team (or free-for-all) match in one call
+        /// Each team's aggregate stats and each player's z-scores are
+        /// computed exactly once and reused across all opponent
+        /// pairings; player updates use the multi-opponent Glicko-2
+        /// accumulation over every opposing team
+        /// With two teams this reduces exactly to ProcessMatch
+        /// @param match Teams, rosters and final placements
+        static void ProcessMultiMatch(MultiMatchResult& match);
+
+        /// Process a multi-team match using a caller-provided workspace
+        /// @param match Teams, rosters and final placements
+        /// @param scratch Reusable workspace (typically one per worker thread)
+        static void ProcessMultiMatch(MultiMatchResult& match, MultiMatchScratch& scratch);
+
+        /// Process a batch of matches, distributing independent matches
+        /// across a pool of worker threads
+        /// Matches are partitioned into sequential "waves": two matches that
+        /// share a player (same playerId) are placed in different waves and
+        /// processed in their original order, while matches within a wave
+        /// have disjoint rosters and run in parallel
+        /// Players with playerId < 0 are treated as distinct (no dependency)
+        /// @param matches Batch of match results, in chronological order
+        /// @param numThreads Number of worker threads (0 or 1 = serial)
+        static void ProcessMatches(std::vector<MatchResult>& matches, size_t numThreads);
+
+        /// Process a batch of arena-backed matches with the same wave
+        /// scheduling as the vector overload
+        /// @param matches Array of span-backed matches, in chronological order
+        /// @param count Number of matches
+        /// @param numThreads Number of worker threads (0 or 1 = serial)
+        static void ProcessMatches(ArenaMatchResult* matches, size_t count, size_t numThreads);
+
         /// Update a single player's rating based on team outcome
         /// This implements the single-opponent Glicko-2 update with sign-aware performance scaling
         /// @param player Current player rating
@@ -53,7 +220,107 @@ namespace TeamGlicko2 {
             double score,
             double zScore);
 
+        /// Update a single player's rating against a precomputed opponent
+        /// context; use this form when updating a whole team so the
+        /// opponent-side g(phi) is computed once rather than per player
+        /// @param player Current player rating
+        /// @param opponent Precomputed opponent-side terms
+        /// @param score Match outcome (1.0 = win, 0.0 = loss, 0.5 = draw)
+        /// @param zScore Performance z-score relative to teammates
+        /// @return Updated player rating
+        static PlayerRating UpdatePlayerRating(
+            const PlayerRating& player,
+            const OpponentContext& opponent,
+            double score,
+            double zScore);
+
+        /// In-place twin of the overload above: writes the updated mu,
+        /// phi and sigma straight into player instead of returning a
+        /// fresh PlayerRating for the caller to copy-assign, and keeps
+        /// the performance-tracking fields (perf EMA) rather than
+        /// resetting them; the match-processing hot path uses this form
+        /// @param player Rating updated in place
+        /// @param opponent Precomputed opponent-side terms
+        /// @param score Match outcome (1.0 = win, 0.0 = loss, 0.5 = draw)
+        /// @param zScore Performance z-score relative to teammates
+        static void UpdatePlayerRatingInPlace(
+            PlayerRating& player,
+            const OpponentContext& opponent,
+            double score,
+            double zScore);
+
+        /// Update a single player's rating against several opponents at
+        /// once (the multi-opponent Glicko-2 accumulation):
+        ///   v = [sum_j g_j^2 E_j (1 - E_j)]^(-1)
+        ///   Delta = v * sum_j g_j (s_j - E_j)
+        /// followed by the same volatility / deviation / mean updates
+        /// and sign-aware performance scaling as the single-opponent form
+        /// @param player Current player rating
+        /// @param opponents Precomputed context per opposing team
+        /// @param scores Outcome against each opponent, parallel to opponents
+        /// @param zScore Performance z-score relative to teammates
+        /// @return Updated player rating (unchanged if opponents is empty)
+        static PlayerRating UpdatePlayerRating(
+            const PlayerRating& player,
+            const std::vector<OpponentContext>& opponents,
+            const std::vector<double>& scores,
+            double zScore);
+
+        /// In-place twin of the multi-opponent overload above; like the
+        /// single-opponent in-place form it preserves the
+        /// performance-tracking fields, so ProcessMultiMatch reduces
+        /// exactly to ProcessMatch for two teams
+        /// @param player Rating updated in place (untouched if opponents is empty)
+        /// @param opponents Precomputed context per opposing team
+        /// @param scores Outcome against each opponent, parallel to opponents
+        /// @param zScore Performance z-score relative to teammates
+        static void UpdatePlayerRatingInPlace(
+            PlayerRating& player,
+            const std::vector<OpponentContext>& opponents,
+            const std::vector<double>& scores,
+            double zScore);
+
+        /// Update a single player's rating under a runtime parameter set
+        /// Same algorithm as the overload above, but every tunable comes
+        /// from the supplied config; the default overloads stay on the
+        /// compile-time constants so the common path keeps constant-folding
+        /// @param player Current player rating
+        /// @param opponent Precomputed opponent-side terms
+        /// @param score Match outcome (1.0 = win, 0.0 = loss, 0.5 = draw)
+        /// @param zScore Performance z-score relative to teammates
+        /// @param config Runtime update parameters
+        /// @return Updated player rating
+        static PlayerRating UpdatePlayerRating(
+            const PlayerRating& player,
+            const OpponentContext& opponent,
+            double score,
+            double zScore,
+            const Glicko2Config& config);
+
+        /// In-place twin of the config overload above; preserves the
+        /// performance-tracking fields, keeping the config path's
+        /// behavior identical to the compile-time constant path
+        /// @param player Rating updated in place
+        /// @param opponent Precomputed opponent-side terms
+        /// @param score Match outcome (1.0 = win, 0.0 = loss, 0.5 = draw)
+        /// @param zScore Performance z-score relative to teammates
+        /// @param config Runtime update parameters
+        static void UpdatePlayerRatingInPlace(
+            PlayerRating& player,
+            const OpponentContext& opponent,
+            double score,
+            double zScore,
+            const Glicko2Config& config);
+
     private:
+        /// Shared two-team pipeline over raw spans; both MatchResult
+        /// and ArenaMatchResult processing land here
+        static void ProcessMatchSpans(
+            MatchPlayer* teamA, size_t teamACount,
+            MatchPlayer* teamB, size_t teamBCount,
+            double scoreA, double scoreB,
+            MatchScratch& scratch);
+
         /// Compute the v (variance) term for Glicko-2 update
         /// v = [g(phi_opp)^2 * E * (1 - E)]^(-1)
         static double ComputeVariance(double g, double expectedScore);
@@ -71,6 +338,14 @@ namespace TeamGlicko2 {
             double delta,
             double v);
 
+        /// Volatility update with runtime tau / tolerance / iteration caps
+        static double UpdateVolatility(
+            double sigma,
+            double phi,
+            double delta,
+            double v,
+            const Glicko2Config& config);
+
         /// Helper function f(x) for volatility update
         static double VolatilityFunction(
             double x,
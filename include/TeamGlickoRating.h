@@ -15,11 +15,14 @@ namespace TeamGlicko2 {
                     double ratingDeviation = TeamGlicko2::kDefaultRD,
                     double volatility = TeamGlicko2::kDefaultVolatility);
 
-        /// Copy constructor
-        PlayerRating(const PlayerRating& other);
-
-        /// Assignment operator
-        PlayerRating& operator=(const PlayerRating& other);
+        /// Copy and move operations are the compiler-generated
+        /// memberwise ones; the state is all scalars, so defaulting
+        /// keeps PlayerRating trivially copyable (vectors of ratings
+        /// can grow by memcpy) and no longer suppresses moves
+        PlayerRating(const PlayerRating& other) = default;
+        PlayerRating(PlayerRating&& other) = default;
+        PlayerRating& operator=(const PlayerRating& other) = default;
+        PlayerRating& operator=(PlayerRating&& other) = default;
 
         // ========== Glicko-1 Scale Getters (R, RD) ==========
 
@@ -55,10 +58,10 @@ namespace TeamGlicko2 {
         void SetVolatility(double vol) { sigma = vol; }
 
         /// Set rating from Glicko-2 scale (mu)
-        void SetMu(double muValue) { mu = muValue; }
+        void SetMu(double muValue) { mu = muValue; InvalidateEffectiveRating(); }
 
         /// Set rating deviation from Glicko-2 scale (phi)
-        void SetPhi(double phiValue) { phi = phiValue; }
+        void SetPhi(double phiValue) { phi = phiValue; InvalidateEffectiveRating(); }
 
         /// Set volatility from Glicko-2 scale (sigma)
         void SetSigma(double sigmaValue) { sigma = sigmaValue; }
@@ -72,7 +75,7 @@ namespace TeamGlicko2 {
         int GetPerfGames() const { return perfGames; }
 
         /// Set recent performance index
-        void SetPerfIndexEMA(double value) { perfIndexEMA = value; }
+        void SetPerfIndexEMA(double value) { perfIndexEMA = value; InvalidateEffectiveRating(); }
 
         /// Set performance games count
         void SetPerfGames(int count) { perfGames = count; }
@@ -90,6 +93,9 @@ namespace TeamGlicko2 {
 
         /// Compute effective rating: blend of long-term Glicko and recent performance
         /// Uses RD as trust factor - high RD allows more performance influence
+        /// The default-parameter result is cached and invalidated when
+        /// mu, phi or the performance EMA change, so repeated matchmaking
+        /// reads between rating writes are a plain load
         /// @param perfToRating rating points per 1σ of performance (default from config)
         /// @param rdScale RD scale constant for blending (default from config)
         /// @return Effective rating for matchmaking/balancing
@@ -120,6 +126,9 @@ namespace TeamGlicko2 {
         friend std::ostream& operator<<(std::ostream& os, const PlayerRating& rating);
 
     private:
+        /// Mark the cached effective rating stale after a rating write
+        void InvalidateEffectiveRating() { effectiveRatingValid = false; }
+
         /// Internal rating (Glicko-2 scale)
         double mu;
 
@@ -134,6 +143,13 @@ namespace TeamGlicko2 {
 
         /// Number of games contributing to performance index
         int perfGames;
+
+        /// Cached default-parameter effective rating
+        /// mutable so the const read path can fill it lazily
+        mutable double cachedEffectiveRating;
+
+        /// Whether cachedEffectiveRating matches the current state
+        mutable bool effectiveRatingValid;
     };
 
 }  // namespace TeamGlicko2
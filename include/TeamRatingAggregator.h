@@ -1,6 +1,7 @@
 #ifndef GLICKO2_INCLUDE_TEAMRATINGAGGREGATOR_H_
 #define GLICKO2_INCLUDE_TEAMRATINGAGGREGATOR_H_
 
+#include <cstddef>
 #include <vector>
 #include <cmath>
 #include "TeamGlickoRating.h"
@@ -24,13 +25,55 @@ namespace TeamGlicko2 {
         /// @return TeamRatingStats containing mu_T and phi_T
         static TeamRatingStats ComputeTeamStats(const std::vector<PlayerRating>& team);
 
+        /// Span form over a contiguous roster (e.g. arena-backed teams
+        /// or a slice of a larger array); the vector overload delegates
+        /// here, so callers holding raw storage skip the temporary
+        /// @param team Pointer to the first player rating
+        /// @param n Number of players
+        /// @return TeamRatingStats containing mu_T and phi_T
+        static TeamRatingStats ComputeTeamStats(const PlayerRating* team, std::size_t n);
+
+        /// Compute aggregated statistics from contiguous rating columns
+        /// Reduces plain double arrays (e.g. RatingStore columns or
+        /// gathered team slices), so the loops are dense unit-stride
+        /// sums the autovectorizer turns into SIMD reductions instead
+        /// of strided loads across 40-byte PlayerRating objects
+        /// @param mu Player ratings (Glicko-2 scale)
+        /// @param phi Player rating deviations (Glicko-2 scale)
+        /// @param n Number of players
+        /// @return TeamRatingStats containing mu_T and phi_T
+        static TeamRatingStats ComputeTeamStats(const double* mu, const double* phi, std::size_t n);
+
+        /// Aggregate many teams in one call (recompute pipelines)
+        /// Teams are concatenated in the column arrays; team t covers
+        /// entries [offsets[t], offsets[t] + sizes[t])
+        /// @param mu Concatenated player ratings for all teams
+        /// @param phi Concatenated player rating deviations
+        /// @param offsets Start index per team
+        /// @param sizes Player count per team
+        /// @param numTeams Number of teams
+        /// @param outStats Output array of numTeams entries
+        static void ComputeTeamStatsBatch(
+            const double* mu,
+            const double* phi,
+            const std::size_t* offsets,
+            const std::size_t* sizes,
+            std::size_t numTeams,
+            TeamRatingStats* outStats);
+
         /// Compute team mean rating (mu_T)
         /// mu_T = (1/|T|) * sum(mu_i for i in T)
         static double ComputeTeamMu(const std::vector<PlayerRating>& team);
 
+        /// Span form of ComputeTeamMu
+        static double ComputeTeamMu(const PlayerRating* team, std::size_t n);
+
         /// Compute team rating deviation (phi_T)
         /// phi_T = sqrt((1/|T|^2) * sum(phi_i^2 for i in T))
         static double ComputeTeamPhi(const std::vector<PlayerRating>& team);
+
+        /// Span form of ComputeTeamPhi
+        static double ComputeTeamPhi(const PlayerRating* team, std::size_t n);
     };
 
 }  // namespace TeamGlicko2
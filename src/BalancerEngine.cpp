@@ -0,0 +1,80 @@
+#include "BalancerEngine.h"
+#include <utility>
+
+namespace TeamGlicko2 {
+    BalancerEngine::BalancerEngine(std::size_t numThreads)
+        : stopping(false) {
+        if (numThreads == 0) {
+            numThreads = std::thread::hardware_concurrency();
+            if (numThreads == 0) {
+                numThreads = 1;
+            }
+        }
+
+        workers.reserve(numThreads);
+        for (std::size_t i = 0; i < numThreads; ++i) {
+            workers.emplace_back(&BalancerEngine::WorkerLoop, this);
+        }
+    }
+
+    BalancerEngine::~BalancerEngine() {
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            stopping = true;
+        }
+        jobsCondition.notify_all();
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    std::future<TeamAssignment> BalancerEngine::Submit(
+        std::vector<PlayerInfo> players,
+        const BalancerConfig& config) {
+        Job job;
+        job.players = std::move(players);
+        job.config = config;
+        std::future<TeamAssignment> future = job.promise.get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            jobs.push_back(std::move(job));
+        }
+        jobsCondition.notify_one();
+
+        return future;
+    }
+
+    std::size_t BalancerEngine::PendingJobs() const {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        return jobs.size();
+    }
+
+    void BalancerEngine::WorkerLoop() {
+        for (;;) {
+            Job job;
+
+            {
+                std::unique_lock<std::mutex> lock(jobsMutex);
+                jobsCondition.wait(lock, [this]() {
+                    return stopping || !jobs.empty();
+                });
+
+                if (jobs.empty()) {
+                    // stopping and drained: shut this worker down
+                    return;
+                }
+
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+
+            // The job is consumed here; hand the lobby to the rvalue
+            // overload so it is sorted in place rather than copied
+            job.promise.set_value(
+                TeamBalancer::BalanceTeams(std::move(job.players), job.config));
+        }
+    }
+
+}  // namespace TeamGlicko2
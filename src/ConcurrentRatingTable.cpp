@@ -0,0 +1,147 @@
+#include "ConcurrentRatingTable.h"
+
+namespace TeamGlicko2 {
+    namespace {
+        /// Smallest power of two >= value (minimum 16)
+        std::size_t RoundUpPowerOfTwo(std::size_t value) {
+            std::size_t result = 16;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+    }  // namespace
+
+    ConcurrentRatingTable::ConcurrentRatingTable(std::size_t expectedPlayers,
+                                                 std::size_t numShards)
+        : shards(RoundUpPowerOfTwo(numShards > 0 ? numShards : 1)),
+          shardMask(shards.size() - 1) {
+        // Size each shard for its share of the expected population,
+        // leaving headroom below the 70% rehash threshold
+        std::size_t perShard = RoundUpPowerOfTwo(
+            (expectedPlayers / shards.size()) * 2 + 16);
+        for (auto& shard : shards) {
+            shard.ids.assign(perShard, kEmptyRatingSlot);
+            shard.ratings.assign(perShard, PlayerRating());
+        }
+    }
+
+    std::uint64_t ConcurrentRatingTable::HashId(std::uint64_t id) {
+        // splitmix64 finalizer: cheap and avalanches sequential ids
+        std::uint64_t h = id + 0x9E3779B97F4A7C15ull;
+        h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+        h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+        return h ^ (h >> 31);
+    }
+
+    std::size_t ConcurrentRatingTable::LockedFind(const Shard& shard,
+                                                  std::uint64_t playerId) {
+        std::size_t mask = shard.ids.size() - 1;
+        std::size_t slot = static_cast<std::size_t>(HashId(playerId)) & mask;
+
+        while (shard.ids[slot] != kEmptyRatingSlot) {
+            if (shard.ids[slot] == playerId) {
+                return slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        return static_cast<std::size_t>(-1);
+    }
+
+    void ConcurrentRatingTable::LockedRehash(Shard& shard) {
+        std::vector<std::uint64_t> oldIds;
+        std::vector<PlayerRating> oldRatings;
+        oldIds.swap(shard.ids);
+        oldRatings.swap(shard.ratings);
+
+        std::size_t newSize = oldIds.size() * 2;
+        shard.ids.assign(newSize, kEmptyRatingSlot);
+        shard.ratings.assign(newSize, PlayerRating());
+
+        std::size_t mask = newSize - 1;
+        for (std::size_t i = 0; i < oldIds.size(); ++i) {
+            if (oldIds[i] == kEmptyRatingSlot) {
+                continue;
+            }
+            std::size_t slot = static_cast<std::size_t>(HashId(oldIds[i])) & mask;
+            while (shard.ids[slot] != kEmptyRatingSlot) {
+                slot = (slot + 1) & mask;
+            }
+            shard.ids[slot] = oldIds[i];
+            shard.ratings[slot] = oldRatings[i];
+        }
+    }
+
+    PlayerRating& ConcurrentRatingTable::LockedFindOrInsert(Shard& shard,
+                                                            std::uint64_t playerId) {
+        // Grow before probing once the shard passes 70% load
+        if ((shard.count + 1) * 10 > shard.ids.size() * 7) {
+            LockedRehash(shard);
+        }
+
+        std::size_t mask = shard.ids.size() - 1;
+        std::size_t slot = static_cast<std::size_t>(HashId(playerId)) & mask;
+
+        while (shard.ids[slot] != kEmptyRatingSlot) {
+            if (shard.ids[slot] == playerId) {
+                return shard.ratings[slot];
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        shard.ids[slot] = playerId;
+        shard.ratings[slot] = PlayerRating();
+        shard.count++;
+        return shard.ratings[slot];
+    }
+
+    void ConcurrentRatingTable::Put(std::uint64_t playerId, const PlayerRating& rating) {
+        Shard& shard = ShardFor(playerId);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        LockedFindOrInsert(shard, playerId) = rating;
+    }
+
+    bool ConcurrentRatingTable::TryGet(std::uint64_t playerId, PlayerRating& out) const {
+        const Shard& shard = ShardFor(playerId);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::size_t slot = LockedFind(shard, playerId);
+        if (slot == static_cast<std::size_t>(-1)) {
+            return false;
+        }
+
+        out = shard.ratings[slot];
+        return true;
+    }
+
+    std::vector<ConcurrentRatingTable::Entry> ConcurrentRatingTable::Snapshot() const {
+        std::vector<Entry> result;
+        result.reserve(Size());
+
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (std::size_t i = 0; i < shard.ids.size(); ++i) {
+                if (shard.ids[i] == kEmptyRatingSlot) {
+                    continue;
+                }
+                Entry entry;
+                entry.playerId = shard.ids[i];
+                entry.rating = shard.ratings[i];
+                result.push_back(entry);
+            }
+        }
+
+        return result;
+    }
+
+    std::size_t ConcurrentRatingTable::Size() const {
+        std::size_t total = 0;
+        for (const auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total += shard.count;
+        }
+        return total;
+    }
+
+}  // namespace TeamGlicko2
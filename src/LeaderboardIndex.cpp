@@ -0,0 +1,151 @@
+#include "LeaderboardIndex.h"
+#include <algorithm>
+
+namespace TeamGlicko2 {
+    LeaderboardIndex::LeaderboardIndex(double minRating, double maxRating,
+                                       double bucketWidth)
+        : minRating(minRating)
+        , bucketWidth(bucketWidth > 0.0 ? bucketWidth : 1.0) {
+        double span = maxRating > minRating ? maxRating - minRating : 1.0;
+        bucketCount = static_cast<std::size_t>(span / this->bucketWidth) + 1;
+        tree.assign(bucketCount + 1, 0);
+        buckets.assign(bucketCount, std::vector<std::uint64_t>());
+    }
+
+    std::size_t LeaderboardIndex::BucketOf(double rating) const {
+        if (rating <= minRating) {
+            return 0;
+        }
+        std::size_t bucket = static_cast<std::size_t>((rating - minRating) / bucketWidth);
+        return bucket < bucketCount ? bucket : bucketCount - 1;
+    }
+
+    void LeaderboardIndex::AddToTree(std::size_t bucket, int delta) {
+        // Standard Fenwick point update over the 1-based tree
+        for (std::size_t i = bucket + 1; i <= bucketCount; i += i & (~i + 1)) {
+            tree[i] += delta;
+        }
+    }
+
+    std::size_t LeaderboardIndex::CountAbove(std::size_t bucket) const {
+        // Players in buckets [0, bucket] via Fenwick prefix sum,
+        // subtracted from the total
+        int prefix = 0;
+        for (std::size_t i = bucket + 1; i > 0; i -= i & (~i + 1)) {
+            prefix += tree[i];
+        }
+        return ratingOf.size() - static_cast<std::size_t>(prefix);
+    }
+
+    void LeaderboardIndex::Update(std::uint64_t playerId, double rating) {
+        auto it = ratingOf.find(playerId);
+        if (it != ratingOf.end()) {
+            std::size_t oldBucket = BucketOf(it->second);
+            std::size_t newBucket = BucketOf(rating);
+            it->second = rating;
+
+            if (oldBucket == newBucket) {
+                return;  // Rank structure unchanged, only the exact rating moved
+            }
+
+            // Move the id between bucket lists
+            auto& oldList = buckets[oldBucket];
+            for (std::size_t i = 0; i < oldList.size(); ++i) {
+                if (oldList[i] == playerId) {
+                    oldList[i] = oldList.back();
+                    oldList.pop_back();
+                    break;
+                }
+            }
+            buckets[newBucket].push_back(playerId);
+            AddToTree(oldBucket, -1);
+            AddToTree(newBucket, +1);
+            return;
+        }
+
+        std::size_t bucket = BucketOf(rating);
+        ratingOf.emplace(playerId, rating);
+        buckets[bucket].push_back(playerId);
+        AddToTree(bucket, +1);
+    }
+
+    bool LeaderboardIndex::Remove(std::uint64_t playerId) {
+        auto it = ratingOf.find(playerId);
+        if (it == ratingOf.end()) {
+            return false;
+        }
+
+        std::size_t bucket = BucketOf(it->second);
+        auto& list = buckets[bucket];
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            if (list[i] == playerId) {
+                list[i] = list.back();
+                list.pop_back();
+                break;
+            }
+        }
+
+        AddToTree(bucket, -1);
+        ratingOf.erase(it);
+        return true;
+    }
+
+    std::vector<LeaderboardIndex::Entry> LeaderboardIndex::TopK(std::size_t k) const {
+        std::vector<Entry> result;
+        if (k == 0 || ratingOf.empty()) {
+            return result;
+        }
+
+        // Collect whole buckets from the top until at least k candidates
+        // are gathered, then order the candidates by exact rating
+        for (std::size_t b = bucketCount; b > 0; --b) {
+            const auto& list = buckets[b - 1];
+            for (std::uint64_t id : list) {
+                Entry entry;
+                entry.playerId = id;
+                entry.rating = ratingOf.at(id);
+                result.push_back(entry);
+            }
+            if (result.size() >= k) {
+                break;
+            }
+        }
+
+        std::sort(result.begin(), result.end(),
+                  [](const Entry& a, const Entry& b) {
+                      if (a.rating != b.rating) return a.rating > b.rating;
+                      return a.playerId < b.playerId;
+                  });
+
+        if (result.size() > k) {
+            result.resize(k);
+        }
+        return result;
+    }
+
+    std::size_t LeaderboardIndex::RankOf(std::uint64_t playerId) const {
+        auto it = ratingOf.find(playerId);
+        if (it == ratingOf.end()) {
+            return 0;
+        }
+
+        double rating = it->second;
+        std::size_t bucket = BucketOf(rating);
+
+        // Players in strictly higher buckets, counted by the tree, plus
+        // players ahead of us inside our own bucket by exact rating
+        std::size_t rank = CountAbove(bucket) + 1;
+        for (std::uint64_t id : buckets[bucket]) {
+            if (id == playerId) {
+                continue;
+            }
+            double other = ratingOf.at(id);
+            if (other > rating || (other == rating && id < playerId)) {
+                rank++;
+            }
+        }
+
+        return rank;
+    }
+
+}  // namespace TeamGlicko2
@@ -0,0 +1,75 @@
+#include "MatchArena.h"
+
+namespace TeamGlicko2 {
+    MatchArena::MatchArena(std::size_t blockSize)
+        : currentBlock(0)
+        , blockSize(blockSize > 0 ? blockSize : kDefaultBlockSize) {
+        blocks.emplace_back();
+        blocks[0].storage.resize(this->blockSize);
+    }
+
+    void* MatchArena::Allocate(std::size_t bytes, std::size_t alignment) {
+        // Oversized requests get a dedicated, fully-consumed block
+        // inserted behind the cursor, so the current block stays usable
+        // for subsequent small allocations
+        std::size_t needed = bytes + alignment;
+        if (needed > blockSize) {
+            Block dedicated;
+            dedicated.storage.resize(needed);
+            dedicated.used = needed;
+
+            std::size_t base = reinterpret_cast<std::size_t>(dedicated.storage.data());
+            std::size_t aligned = (base + alignment - 1) & ~(alignment - 1);
+
+            blocks.insert(blocks.begin() + currentBlock, std::move(dedicated));
+            currentBlock++;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // Bump within the current block, advancing to the next (or a
+        // fresh) block when the remainder is too small
+        while (true) {
+            Block& block = blocks[currentBlock];
+            std::size_t base = reinterpret_cast<std::size_t>(block.storage.data());
+            std::size_t cursor = base + block.used;
+            std::size_t aligned = (cursor + alignment - 1) & ~(alignment - 1);
+            std::size_t newUsed = aligned - base + bytes;
+
+            if (newUsed <= block.storage.size()) {
+                block.used = newUsed;
+                return reinterpret_cast<void*>(aligned);
+            }
+
+            currentBlock++;
+            if (currentBlock == blocks.size()) {
+                blocks.emplace_back();
+                blocks.back().storage.resize(blockSize);
+            }
+        }
+    }
+
+    ArenaMatchResult MatchArena::MakeMatch(std::size_t teamACount, std::size_t teamBCount) {
+        ArenaMatchResult match;
+        match.teamA = AllocateArray<MatchPlayer>(teamACount);
+        match.teamACount = teamACount;
+        match.teamB = AllocateArray<MatchPlayer>(teamBCount);
+        match.teamBCount = teamBCount;
+        return match;
+    }
+
+    void MatchArena::Reset() {
+        for (auto& block : blocks) {
+            block.used = 0;
+        }
+        currentBlock = 0;
+    }
+
+    std::size_t MatchArena::BytesUsed() const {
+        std::size_t total = 0;
+        for (const auto& block : blocks) {
+            total += block.used;
+        }
+        return total;
+    }
+
+}  // namespace TeamGlicko2
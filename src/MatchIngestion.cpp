@@ -0,0 +1,699 @@
+#include "MatchIngestion.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TeamGlicko2 {
+    namespace {
+        /// Non-owning view over a character range in the mapped file
+        struct Field {
+            const char* data;
+            std::size_t size;
+
+            bool Equals(const char* literal) const {
+                std::size_t length = std::strlen(literal);
+                return size == length && std::memcmp(data, literal, length) == 0;
+            }
+        };
+
+        /// Read-only mapping of the whole input file
+        struct MappedFile {
+            const char* data;
+            std::size_t size;
+#ifndef _WIN32
+            void* mapping;
+#else
+            std::vector<char> buffer;
+#endif
+
+            MappedFile() : data(nullptr), size(0)
+#ifndef _WIN32
+                , mapping(nullptr)
+#endif
+            {}
+
+            ~MappedFile() {
+#ifndef _WIN32
+                if (mapping != nullptr) {
+                    ::munmap(mapping, size);
+                }
+#endif
+            }
+
+            bool Open(const std::string& path) {
+#ifndef _WIN32
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    return false;
+                }
+
+                struct stat fileStat;
+                if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+                    ::close(fd);
+                    return false;
+                }
+                size = static_cast<std::size_t>(fileStat.st_size);
+
+                void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (mapped == MAP_FAILED) {
+                    return false;
+                }
+
+                mapping = mapped;
+                data = static_cast<const char*>(mapped);
+                return true;
+#else
+                std::FILE* file = std::fopen(path.c_str(), "rb");
+                if (file == nullptr) {
+                    return false;
+                }
+                std::fseek(file, 0, SEEK_END);
+                long fileSize = std::ftell(file);
+                std::fseek(file, 0, SEEK_SET);
+                if (fileSize <= 0) {
+                    std::fclose(file);
+                    return false;
+                }
+                size = static_cast<std::size_t>(fileSize);
+                buffer.resize(size);
+                bool ok = std::fread(buffer.data(), 1, size, file) == size;
+                std::fclose(file);
+                if (!ok) {
+                    return false;
+                }
+                data = buffer.data();
+                return true;
+#endif
+            }
+        };
+
+        /// FNV-1a hash over a character range
+        std::uint64_t HashRange(const char* data, std::size_t size) {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (std::size_t i = 0; i < size; ++i) {
+                hash ^= static_cast<unsigned char>(data[i]);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        /// Split one line into fields on the delimiter, reusing the buffer
+        void SplitLine(const char* line, std::size_t length,
+                       std::vector<Field>& outFields) {
+            outFields.clear();
+            std::size_t fieldStart = 0;
+            for (std::size_t i = 0; i <= length; ++i) {
+                if (i == length || line[i] == ',') {
+                    Field field;
+                    field.data = line + fieldStart;
+                    field.size = i - fieldStart;
+                    outFields.push_back(field);
+                    fieldStart = i + 1;
+                }
+            }
+        }
+
+        /// Parse a non-negative integer from a field (-1 on failure)
+        int ParseInt(const Field& field) {
+            if (field.size == 0) {
+                return -1;
+            }
+            int value = 0;
+            for (std::size_t i = 0; i < field.size; ++i) {
+                char c = field.data[i];
+                if (c < '0' || c > '9') {
+                    return -1;
+                }
+                value = value * 10 + (c - '0');
+            }
+            return value;
+        }
+
+        /// Parse a double from a field via a bounded stack buffer
+        double ParseDouble(const Field& field) {
+            char buffer[64];
+            std::size_t length = field.size < sizeof(buffer) - 1
+                               ? field.size : sizeof(buffer) - 1;
+            std::memcpy(buffer, field.data, length);
+            buffer[length] = '\0';
+            return std::strtod(buffer, nullptr);
+        }
+
+        /// One buffered roster row of the match currently being grouped
+        struct PendingRow {
+            PlayerHandle handle;
+            double performanceScore;
+            bool isRed;
+        };
+
+        /// Performance score from raw stats (same formula as the
+        /// batch_processor example)
+        double ComputePerformanceScore(int kills, int deaths, double damage, double score) {
+            double perfScore = (kills * kKillWeight)
+                             + (deaths * kDeathWeight)  // Note: kDeathWeight is negative
+                             + (damage * kDamageWeight)
+                             + (score * kObjectiveWeight);
+            double minimum = 100.0;
+            return perfScore > minimum ? perfScore : minimum;
+        }
+    }  // namespace
+
+    StringInterner::StringInterner()
+        : table(256, -1) {
+    }
+
+    std::uint32_t StringInterner::Intern(const char* data, std::size_t size) {
+        std::uint64_t hash = HashRange(data, size);
+        std::size_t mask = table.size() - 1;
+        std::size_t slot = static_cast<std::size_t>(hash) & mask;
+
+        while (table[slot] >= 0) {
+            std::uint32_t index = static_cast<std::uint32_t>(table[slot]);
+            if (hashes[index] == hash &&
+                names[index].size() == size &&
+                std::memcmp(names[index].data(), data, size) == 0) {
+                return index;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        // First occurrence: copy the string and claim the slot
+        std::uint32_t index = static_cast<std::uint32_t>(names.size());
+        names.emplace_back(data, size);
+        hashes.push_back(hash);
+        table[slot] = static_cast<std::int32_t>(index);
+
+        // Keep the load factor below ~70%
+        if (names.size() * 10 >= table.size() * 7) {
+            Rehash(table.size() * 2);
+        }
+
+        return index;
+    }
+
+    void StringInterner::Rehash(std::size_t newTableSize) {
+        table.assign(newTableSize, -1);
+        std::size_t mask = newTableSize - 1;
+
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            std::size_t slot = static_cast<std::size_t>(hashes[i]) & mask;
+            while (table[slot] >= 0) {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = static_cast<std::int32_t>(i);
+        }
+    }
+
+    namespace {
+        /// Per-complete-match sink for the shared parse loop
+        typedef std::function<void(
+            int matchId,
+            const std::vector<PendingRow>& rows,
+            double scoreA,
+            double scoreB)> MatchFlush;
+
+        /// Create default rating slots for any handles the store has
+        /// not seen yet
+        void GrowStore(RatingStore& store, const std::vector<PendingRow>& rows) {
+            for (const auto& row : rows) {
+                while (row.handle >= store.Size()) {
+                    store.Add();
+                }
+            }
+        }
+    }  // namespace
+
+    /// Shared streaming parse loop behind Replay, Collect and the
+    /// pipelined replay: groups contiguous rows by match id and hands
+    /// each complete match (with a known winner) to the flush sink
+    /// Does not touch the rating store, so it can run concurrently
+    /// with a compute stage; sinks grow the store themselves
+    static bool ParseMatchRows(
+        const std::string& path,
+        StringInterner& interner,
+        IngestionStats& outStats,
+        const MatchFlush& flush) {
+        outStats = IngestionStats();
+
+        MappedFile file;
+        if (!file.Open(path)) {
+            return false;
+        }
+
+        const char* cursor = file.data;
+        const char* end = file.data + file.size;
+
+        std::vector<Field> fields;
+        fields.reserve(16);
+
+        // Parse the header line to find column indices
+        const char* lineEnd = static_cast<const char*>(
+            std::memchr(cursor, '\n', end - cursor));
+        if (lineEnd == nullptr) {
+            return false;
+        }
+
+        std::size_t headerLength = lineEnd - cursor;
+        if (headerLength > 0 && cursor[headerLength - 1] == '\r') {
+            headerLength--;
+        }
+        SplitLine(cursor, headerLength, fields);
+
+        int scoreIdx = -1, killsIdx = -1, deathIdx = -1, teamIdx = -1;
+        int damageIdx = -1, matchIdIdx = -1, playerIdIdx = -1, winnerIdx = -1;
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            if (fields[i].Equals("Score")) scoreIdx = static_cast<int>(i);
+            else if (fields[i].Equals("KILLS")) killsIdx = static_cast<int>(i);
+            else if (fields[i].Equals("DEATH")) deathIdx = static_cast<int>(i);
+            else if (fields[i].Equals("TEAM")) teamIdx = static_cast<int>(i);
+            else if (fields[i].Equals("DAMAGE")) damageIdx = static_cast<int>(i);
+            else if (fields[i].Equals("MATCHID")) matchIdIdx = static_cast<int>(i);
+            else if (fields[i].Equals("PLAYERID")) playerIdIdx = static_cast<int>(i);
+            else if (fields[i].Equals("Winner")) winnerIdx = static_cast<int>(i);
+        }
+
+        if (killsIdx < 0 || deathIdx < 0 || teamIdx < 0 ||
+            matchIdIdx < 0 || playerIdIdx < 0 || winnerIdx < 0) {
+            return false;
+        }
+
+        std::size_t requiredFields = fields.size();
+        cursor = lineEnd + 1;
+
+        // Streaming group-by-match state: rows of the current match
+        // are buffered, then flushed as soon as the match id changes
+        int currentMatchId = -1;
+        double scoreA = 0.0, scoreB = 0.0;
+        bool winnerKnown = false;
+        std::vector<PendingRow> pendingRows;
+        pendingRows.reserve(16);
+
+        auto flushMatch = [&]() {
+            if (pendingRows.empty()) {
+                return;
+            }
+            if (winnerKnown) {
+                flush(currentMatchId, pendingRows, scoreA, scoreB);
+            }
+            pendingRows.clear();
+        };
+
+        while (cursor < end) {
+            lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+            std::size_t lineLength = (lineEnd != nullptr)
+                                   ? static_cast<std::size_t>(lineEnd - cursor)
+                                   : static_cast<std::size_t>(end - cursor);
+            if (lineLength > 0 && cursor[lineLength - 1] == '\r') {
+                lineLength--;
+            }
+
+            if (lineLength == 0) {
+                cursor = (lineEnd != nullptr) ? lineEnd + 1 : end;
+                continue;
+            }
+
+            SplitLine(cursor, lineLength, fields);
+            cursor = (lineEnd != nullptr) ? lineEnd + 1 : end;
+            outStats.rowsParsed++;
+
+            if (fields.size() < requiredFields) {
+                outStats.rowsSkipped++;
+                continue;
+            }
+
+            const Field& team = fields[teamIdx];
+            bool isRed = team.Equals("Red");
+            if (!isRed && !team.Equals("Blue")) {
+                outStats.rowsSkipped++;  // Skip spectators
+                continue;
+            }
+
+            int matchId = ParseInt(fields[matchIdIdx]);
+            if (matchId < 0) {
+                outStats.rowsSkipped++;
+                continue;
+            }
+
+            // Match boundary: process everything buffered so far
+            if (matchId != currentMatchId) {
+                flushMatch();
+                currentMatchId = matchId;
+                winnerKnown = false;
+            }
+
+            // Resolve the player id to a dense handle; the sink creates
+            // the rating slot before its first store access
+            std::uint32_t index = interner.Intern(
+                fields[playerIdIdx].data, fields[playerIdIdx].size);
+
+            PendingRow row;
+            row.handle = static_cast<PlayerHandle>(index);
+            row.isRed = isRed;
+
+            int kills = ParseInt(fields[killsIdx]);
+            int deaths = ParseInt(fields[deathIdx]);
+            double damage = (damageIdx >= 0) ? ParseDouble(fields[damageIdx]) : 0.0;
+            double objective = (scoreIdx >= 0) ? ParseDouble(fields[scoreIdx]) : 0.0;
+            row.performanceScore = ComputePerformanceScore(kills, deaths, damage, objective);
+
+            const Field& winner = fields[winnerIdx];
+            if (winner.Equals("Draw")) {
+                scoreA = kDrawScore;
+                scoreB = kDrawScore;
+                winnerKnown = true;
+            } else if (winner.Equals("Red")) {
+                scoreA = kWinScore;
+                scoreB = kLossScore;
+                winnerKnown = true;
+            } else if (winner.Equals("Blue")) {
+                scoreA = kLossScore;
+                scoreB = kWinScore;
+                winnerKnown = true;
+            }
+
+            pendingRows.push_back(row);
+        }
+
+        flushMatch();
+        outStats.uniquePlayers = interner.Size();
+        return true;
+    }
+
+    bool MatchIngestion::Replay(
+        const std::string& path,
+        RatingStore& store,
+        StringInterner& interner,
+        IngestionStats& outStats,
+        const MatchCallback& callback) {
+        MatchResult result;
+        MatchScratch scratch;
+        std::vector<PlayerHandle> teamAHandles;
+        std::vector<PlayerHandle> teamBHandles;
+
+        return ParseMatchRows(path, interner, outStats,
+            [&](int matchId, const std::vector<PendingRow>& rows,
+                double scoreA, double scoreB) {
+                GrowStore(store, rows);
+                result.teamA.clear();
+                result.teamB.clear();
+                teamAHandles.clear();
+                teamBHandles.clear();
+                result.scoreA = scoreA;
+                result.scoreB = scoreB;
+
+                for (const auto& row : rows) {
+                    MatchPlayer player(store.Get(row.handle), row.performanceScore,
+                                       static_cast<int>(row.handle));
+                    if (row.isRed) {
+                        result.teamA.push_back(player);
+                        teamAHandles.push_back(row.handle);
+                    } else {
+                        result.teamB.push_back(player);
+                        teamBHandles.push_back(row.handle);
+                    }
+                }
+
+                if (result.teamA.empty() || result.teamB.empty()) {
+                    return;
+                }
+
+                TeamGlicko2System::ProcessMatch(result, scratch);
+
+                // Commit updated ratings back to the store
+                for (std::size_t i = 0; i < teamAHandles.size(); ++i) {
+                    store.Set(teamAHandles[i], result.teamA[i].rating);
+                }
+                for (std::size_t i = 0; i < teamBHandles.size(); ++i) {
+                    store.Set(teamBHandles[i], result.teamB[i].rating);
+                }
+
+                outStats.matchesProcessed++;
+                if (callback) {
+                    callback(matchId, result, teamAHandles, teamBHandles);
+                }
+            });
+    }
+
+    bool MatchIngestion::Collect(
+        const std::string& path,
+        RatingStore& store,
+        StringInterner& interner,
+        MatchArena& arena,
+        std::vector<ArenaMatchResult>& outMatches,
+        IngestionStats& outStats) {
+        return ParseMatchRows(path, interner, outStats,
+            [&](int /*matchId*/, const std::vector<PendingRow>& rows,
+                double scoreA, double scoreB) {
+                GrowStore(store, rows);
+                std::size_t redCount = 0;
+                for (const auto& row : rows) {
+                    if (row.isRed) {
+                        redCount++;
+                    }
+                }
+                std::size_t blueCount = rows.size() - redCount;
+                if (redCount == 0 || blueCount == 0) {
+                    return;
+                }
+
+                // Carve both rosters out of the arena in one go
+                ArenaMatchResult match = arena.MakeMatch(redCount, blueCount);
+                match.scoreA = scoreA;
+                match.scoreB = scoreB;
+
+                std::size_t a = 0;
+                std::size_t b = 0;
+                for (const auto& row : rows) {
+                    MatchPlayer player(store.Get(row.handle), row.performanceScore,
+                                       static_cast<int>(row.handle));
+                    if (row.isRed) {
+                        match.teamA[a++] = player;
+                    } else {
+                        match.teamB[b++] = player;
+                    }
+                }
+
+                outMatches.push_back(match);
+                outStats.matchesProcessed++;
+            });
+    }
+
+    namespace {
+        /// One complete parsed match in flight between stages
+        struct ParsedMatch {
+            int matchId;
+            double scoreA;
+            double scoreB;
+            std::vector<PendingRow> rows;
+        };
+
+        /// Bounded FIFO handing work between pipeline stages
+        /// Push blocks while the queue is full, which is how a fast
+        /// producer is throttled to the consumer's pace; Pop blocks
+        /// until an item arrives and returns false once the queue is
+        /// closed and drained
+        template <typename T>
+        class BoundedQueue {
+        public:
+            explicit BoundedQueue(std::size_t capacity)
+                : capacity(capacity > 0 ? capacity : 1)
+                , closed(false) {
+            }
+
+            void Push(T&& item) {
+                std::unique_lock<std::mutex> lock(mutex);
+                notFull.wait(lock, [this]() { return items.size() < capacity; });
+                items.push_back(std::move(item));
+                lock.unlock();
+                notEmpty.notify_one();
+            }
+
+            bool Pop(T& out) {
+                std::unique_lock<std::mutex> lock(mutex);
+                notEmpty.wait(lock, [this]() { return !items.empty() || closed; });
+                if (items.empty()) {
+                    return false;
+                }
+                out = std::move(items.front());
+                items.pop_front();
+                lock.unlock();
+                notFull.notify_one();
+                return true;
+            }
+
+            void Close() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    closed = true;
+                }
+                notEmpty.notify_all();
+            }
+
+        private:
+            std::mutex mutex;
+            std::condition_variable notFull;
+            std::condition_variable notEmpty;
+            std::deque<T> items;
+            std::size_t capacity;
+            bool closed;
+        };
+    }  // namespace
+
+    bool MatchIngestion::ReplayPipelined(
+        const std::string& path,
+        RatingStore& store,
+        StringInterner& interner,
+        IngestionStats& outStats,
+        const std::string& outputPath,
+        const MatchFormatter& formatter,
+        const ReplayPipelineOptions& options) {
+        bool writerWanted = !outputPath.empty();
+
+        std::FILE* outFile = nullptr;
+        if (writerWanted) {
+            outFile = std::fopen(outputPath.c_str(), "wb");
+            if (outFile == nullptr) {
+                return false;
+            }
+        }
+
+        BoundedQueue<std::vector<ParsedMatch>> parseQueue(options.queueCapacity);
+        BoundedQueue<std::string> writeQueue(options.queueCapacity);
+
+        // Writer: drain formatted buffers with large sequential writes
+        bool writeOk = true;
+        std::thread writer;
+        if (writerWanted) {
+            writer = std::thread([&]() {
+                std::string buffer;
+                while (writeQueue.Pop(buffer)) {
+                    if (std::fwrite(buffer.data(), 1, buffer.size(), outFile)
+                        != buffer.size()) {
+                        writeOk = false;
+                    }
+                }
+            });
+        }
+
+        // Compute: run the rating math in file order and hand output
+        // buffers to the writer once they reach the flush threshold
+        // Sequential on purpose - each match reads ratings the previous
+        // match wrote, so this stage overlaps with parse and write but
+        // not with itself
+        std::size_t matchesProcessed = 0;
+        std::thread compute([&]() {
+            MatchResult result;
+            MatchScratch scratch;
+            std::vector<PlayerHandle> teamAHandles;
+            std::vector<PlayerHandle> teamBHandles;
+            std::string outBuffer;
+            bool emitOutput = writerWanted && formatter;
+
+            std::vector<ParsedMatch> batch;
+            while (parseQueue.Pop(batch)) {
+                for (const auto& parsed : batch) {
+                    GrowStore(store, parsed.rows);
+                    result.teamA.clear();
+                    result.teamB.clear();
+                    teamAHandles.clear();
+                    teamBHandles.clear();
+                    result.scoreA = parsed.scoreA;
+                    result.scoreB = parsed.scoreB;
+
+                    for (const auto& row : parsed.rows) {
+                        MatchPlayer player(store.Get(row.handle),
+                                           row.performanceScore,
+                                           static_cast<int>(row.handle));
+                        if (row.isRed) {
+                            result.teamA.push_back(player);
+                            teamAHandles.push_back(row.handle);
+                        } else {
+                            result.teamB.push_back(player);
+                            teamBHandles.push_back(row.handle);
+                        }
+                    }
+
+                    if (result.teamA.empty() || result.teamB.empty()) {
+                        continue;
+                    }
+
+                    TeamGlicko2System::ProcessMatch(result, scratch);
+
+                    for (std::size_t i = 0; i < teamAHandles.size(); ++i) {
+                        store.Set(teamAHandles[i], result.teamA[i].rating);
+                    }
+                    for (std::size_t i = 0; i < teamBHandles.size(); ++i) {
+                        store.Set(teamBHandles[i], result.teamB[i].rating);
+                    }
+
+                    matchesProcessed++;
+                    if (emitOutput) {
+                        formatter(parsed.matchId, result,
+                                  teamAHandles, teamBHandles, outBuffer);
+                        if (outBuffer.size() >= options.writeBufferBytes) {
+                            writeQueue.Push(std::move(outBuffer));
+                            outBuffer = std::string();
+                        }
+                    }
+                }
+            }
+
+            if (!outBuffer.empty()) {
+                writeQueue.Push(std::move(outBuffer));
+            }
+            writeQueue.Close();
+        });
+
+        // Parse on the calling thread, batching complete matches onto
+        // the compute queue
+        std::vector<ParsedMatch> batch;
+        batch.reserve(options.batchMatches);
+
+        bool parseOk = ParseMatchRows(path, interner, outStats,
+            [&](int matchId, const std::vector<PendingRow>& rows,
+                double scoreA, double scoreB) {
+                ParsedMatch parsed;
+                parsed.matchId = matchId;
+                parsed.scoreA = scoreA;
+                parsed.scoreB = scoreB;
+                parsed.rows = rows;
+                batch.push_back(std::move(parsed));
+
+                if (batch.size() >= options.batchMatches) {
+                    parseQueue.Push(std::move(batch));
+                    batch = std::vector<ParsedMatch>();
+                    batch.reserve(options.batchMatches);
+                }
+            });
+
+        if (!batch.empty()) {
+            parseQueue.Push(std::move(batch));
+        }
+        parseQueue.Close();
+
+        compute.join();
+        if (writer.joinable()) {
+            writer.join();
+        }
+        if (outFile != nullptr) {
+            std::fclose(outFile);
+        }
+
+        outStats.matchesProcessed = matchesProcessed;
+        return parseOk && writeOk;
+    }
+
+}  // namespace TeamGlicko2
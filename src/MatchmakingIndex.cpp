@@ -0,0 +1,155 @@
+#include "MatchmakingIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace TeamGlicko2 {
+    MatchmakingIndex::MatchmakingIndex(double minRating, double maxRating,
+                                       double bucketWidth, double maxRD,
+                                       double rdBandWidth)
+        : minRating(minRating)
+        , bucketWidth(bucketWidth > 0.0 ? bucketWidth : 1.0)
+        , rdBandWidth(rdBandWidth > 0.0 ? rdBandWidth : 1.0) {
+        double span = maxRating > minRating ? maxRating - minRating : 1.0;
+        bucketCount = static_cast<std::size_t>(span / this->bucketWidth) + 1;
+        double rdSpan = maxRD > 0.0 ? maxRD : 1.0;
+        bandCount = static_cast<std::size_t>(rdSpan / this->rdBandWidth) + 1;
+        cells.assign(bucketCount * bandCount, std::vector<Entry>());
+    }
+
+    std::size_t MatchmakingIndex::BucketOf(double rating) const {
+        if (rating <= minRating) {
+            return 0;
+        }
+        std::size_t bucket = static_cast<std::size_t>((rating - minRating) / bucketWidth);
+        return bucket < bucketCount ? bucket : bucketCount - 1;
+    }
+
+    std::size_t MatchmakingIndex::BandOf(double rd) const {
+        if (rd <= 0.0) {
+            return 0;
+        }
+        std::size_t band = static_cast<std::size_t>(rd / rdBandWidth);
+        return band < bandCount ? band : bandCount - 1;
+    }
+
+    void MatchmakingIndex::Update(std::uint64_t playerId,
+                                  double effectiveRating, double rd) {
+        Cell cell;
+        cell.bucket = BucketOf(effectiveRating);
+        cell.band = BandOf(rd);
+
+        auto found = cellOf.find(playerId);
+        if (found != cellOf.end()) {
+            std::vector<Entry>& entries =
+                CellEntries(found->second.bucket, found->second.band);
+            std::size_t position = 0;
+            while (position < entries.size() &&
+                   entries[position].playerId != playerId) {
+                position++;
+            }
+
+            // Same cell: refresh the exact values in place, which is
+            // the common case for small per-match rating movement
+            if (found->second.bucket == cell.bucket &&
+                found->second.band == cell.band) {
+                entries[position].rating = effectiveRating;
+                entries[position].rd = rd;
+                return;
+            }
+
+            entries[position] = entries.back();
+            entries.pop_back();
+            found->second = cell;
+        } else {
+            cellOf[playerId] = cell;
+        }
+
+        Entry entry;
+        entry.playerId = playerId;
+        entry.rating = effectiveRating;
+        entry.rd = rd;
+        CellEntries(cell.bucket, cell.band).push_back(entry);
+    }
+
+    bool MatchmakingIndex::Remove(std::uint64_t playerId) {
+        auto found = cellOf.find(playerId);
+        if (found == cellOf.end()) {
+            return false;
+        }
+
+        std::vector<Entry>& entries =
+            CellEntries(found->second.bucket, found->second.band);
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i].playerId == playerId) {
+                entries[i] = entries.back();
+                entries.pop_back();
+                break;
+            }
+        }
+
+        cellOf.erase(found);
+        return true;
+    }
+
+    void MatchmakingIndex::GatherBucket(std::size_t bucket, std::size_t maxBand,
+                                        double maxRD,
+                                        std::vector<Entry>& out) const {
+        for (std::size_t band = 0; band <= maxBand; ++band) {
+            for (const Entry& entry : CellEntries(bucket, band)) {
+                // The boundary band can hold entries above the exact
+                // threshold; interior bands qualify wholesale
+                if (entry.rd <= maxRD) {
+                    out.push_back(entry);
+                }
+            }
+        }
+    }
+
+    std::vector<MatchmakingIndex::Entry> MatchmakingIndex::FindCandidates(
+        double targetRating, double maxRD, std::size_t count) const {
+        std::vector<Entry> candidates;
+        if (count == 0) {
+            return candidates;
+        }
+
+        std::size_t center = BucketOf(targetRating);
+        std::size_t maxBand = BandOf(maxRD);
+
+        // Scan outward from the target bucket; once enough candidates
+        // are gathered, finish one more ring so a closer player just
+        // across a bucket boundary cannot be missed, then stop
+        GatherBucket(center, maxBand, maxRD, candidates);
+        bool extraRing = candidates.size() >= count;
+        for (std::size_t ring = 1; ring < bucketCount; ++ring) {
+            bool touched = false;
+            if (center >= ring) {
+                GatherBucket(center - ring, maxBand, maxRD, candidates);
+                touched = true;
+            }
+            if (center + ring < bucketCount) {
+                GatherBucket(center + ring, maxBand, maxRD, candidates);
+                touched = true;
+            }
+            if (!touched || extraRing) {
+                break;
+            }
+            extraRing = candidates.size() >= count;
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [targetRating](const Entry& a, const Entry& b) {
+                      double da = std::fabs(a.rating - targetRating);
+                      double db = std::fabs(b.rating - targetRating);
+                      if (da != db) {
+                          return da < db;
+                      }
+                      return a.playerId < b.playerId;
+                  });
+
+        if (candidates.size() > count) {
+            candidates.resize(count);
+        }
+        return candidates;
+    }
+
+}  // namespace TeamGlicko2
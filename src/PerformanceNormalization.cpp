@@ -1,25 +1,23 @@
 #include "PerformanceNormalization.h"
-#include <numeric>
+#include "RatingKernels.h"
 
 namespace TeamGlicko2 {
     TeamPerformanceStats PerformanceNormalization::ComputeTeamStats(const std::vector<double>& scores) {
+        return ComputeTeamStats(scores.data(), scores.size());
+    }
+
+    TeamPerformanceStats PerformanceNormalization::ComputeTeamStats(
+        const double* scores, std::size_t n) {
         TeamPerformanceStats stats;
-        stats.teamSize = static_cast<int>(scores.size());
+        stats.teamSize = static_cast<int>(n);
 
         if (stats.teamSize == 0) {
             return stats;
         }
 
-        // Compute mean
-        stats.mean = std::accumulate(scores.begin(), scores.end(), 0.0) / stats.teamSize;
-
-        // Compute variance
-        double variance = 0.0;
-        for (double score : scores) {
-            double diff = score - stats.mean;
-            variance += diff * diff;
-        }
-        variance /= stats.teamSize;
+        // Mean and variance in a single fused pass (shared kernel)
+        double variance;
+        RatingKernels::ComputeMoments(scores, n, stats.mean, variance);
 
         // Compute standard deviation with minimum threshold to avoid division by zero
         stats.stddev = (variance < 1e-6) ? 1.0 : std::sqrt(variance);
@@ -31,23 +29,35 @@ namespace TeamGlicko2 {
         const std::vector<double>& scores,
         double maxZScore) {
         std::vector<PlayerPerformance> results;
-        results.reserve(scores.size());
+        NormalizeTeamPerformance(scores, results, maxZScore);
+        return results;
+    }
 
-        // Compute team statistics
-        TeamPerformanceStats stats = ComputeTeamStats(scores);
+    void PerformanceNormalization::NormalizeTeamPerformance(
+        const std::vector<double>& scores,
+        std::vector<PlayerPerformance>& outResults,
+        double maxZScore) {
+        NormalizeTeamPerformance(scores.data(), scores.size(), outResults, maxZScore);
+    }
+
+    void PerformanceNormalization::NormalizeTeamPerformance(
+        const double* scores,
+        std::size_t n,
+        std::vector<PlayerPerformance>& outResults,
+        double maxZScore) {
+        outResults.resize(n);
+
+        // Compute team statistics (single fused pass)
+        TeamPerformanceStats stats = ComputeTeamStats(scores, n);
 
-        // Normalize each player's score
-        for (size_t i = 0; i < scores.size(); ++i) {
-            PlayerPerformance perf;
+        // Normalize each player's score, clipping folded into the loop
+        for (size_t i = 0; i < n; ++i) {
+            PlayerPerformance& perf = outResults[i];
             perf.playerIndex = static_cast<int>(i);
             perf.rawScore = scores[i];
             perf.zScore = ComputeZScore(scores[i], stats);
             perf.clippedZScore = ClipZScore(perf.zScore, maxZScore);
-
-            results.push_back(perf);
         }
-
-        return results;
     }
 
     double PerformanceNormalization::ComputeZScore(double score, const TeamPerformanceStats& stats) {
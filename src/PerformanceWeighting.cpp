@@ -1,4 +1,5 @@
 #include "PerformanceWeighting.h"
+#include "RatingKernels.h"
 #include <cmath>
 #include <algorithm>
 
@@ -6,30 +7,43 @@ namespace TeamGlicko2 {
     std::vector<PlayerWeight> PerformanceWeighting::ComputeZScores(
         const std::vector<double>& performanceScores) {
         std::vector<PlayerWeight> weights;
-        int teamSize = performanceScores.size();
+        ComputeZScores(performanceScores, weights);
+        return weights;
+    }
 
-        if (teamSize == 0) {
-            return weights;
-        }
+    void PerformanceWeighting::ComputeZScores(
+        const std::vector<double>& performanceScores,
+        std::vector<PlayerWeight>& outWeights) {
+        ComputeZScores(performanceScores.data(), performanceScores.size(), outWeights);
+    }
+
+    void PerformanceWeighting::ComputeZScores(
+        const double* performanceScores,
+        std::size_t n,
+        std::vector<PlayerWeight>& outWeights) {
+        std::vector<PlayerWeight>& weights = outWeights;
+        int teamSize = static_cast<int>(n);
 
-        // Initialize weights array
         weights.resize(teamSize);
+        if (teamSize == 0) {
+            return;
+        }
         for (int i = 0; i < teamSize; ++i) {
             weights[i].playerIndex = i;
             weights[i].performanceScore = performanceScores[i];
         }
 
-        // Compute team statistics
-        double mean = ComputeMean(performanceScores);
-        double stddev = ComputeStdDev(performanceScores, mean);
+        // Compute team statistics in a single fused pass
+        double mean;
+        double variance;
+        RatingKernels::ComputeMoments(performanceScores, teamSize, mean, variance);
+        double stddev = std::sqrt(variance) + TeamGlicko2::kEpsilon;
 
         // Compute z-scores for each player
+        // z_i = (p_i - mean) / stddev; no clipping on this path
         for (int i = 0; i < teamSize; ++i) {
-            // z_i = (p_i - mean) / stddev
-            weights[i].zScore = ComputeZScore(performanceScores[i], mean, stddev);
+            weights[i].zScore = (performanceScores[i] - mean) / stddev;
         }
-
-        return weights;
     }
 
     double PerformanceWeighting::ComputeScalingFactor(
@@ -0,0 +1,464 @@
+#include "RatingDeltaLog.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+namespace TeamGlicko2 {
+    namespace {
+        /// 'TGDL' - TeamGlicko2 Delta Log
+        const std::uint32_t kDeltaLogMagic = 0x4C444754u;
+
+        /// 'TGDI' - TeamGlicko2 Delta Index
+        const std::uint32_t kDeltaIndexMagic = 0x49444754u;
+
+        /// Records are staged through a buffer of this many entries so
+        /// appends are group-buffered rather than one syscall each
+        const std::size_t kWriteChunkRecords = 4096;
+
+        /// Log file header preceding the record array
+        struct DeltaLogHeader {
+            std::uint32_t magic;
+            std::uint32_t version;
+        };
+
+        /// Side index header; entries are {playerId, tailOffset} pairs
+        /// recordCount ties the index to a specific log length so a
+        /// stale index (log appended after Close) is detected and ignored
+        struct DeltaIndexHeader {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t entryCount;
+            std::uint64_t recordCount;
+        };
+
+        /// One side-index entry
+        struct DeltaIndexEntry {
+            std::uint64_t playerId;
+            std::int64_t tailOffset;
+        };
+
+        std::string IndexPathFor(const std::string& logPath) {
+            return logPath + ".idx";
+        }
+
+        /// Whether an offset lands exactly on a record boundary
+        bool ValidRecordOffset(std::int64_t offset, std::size_t fileSize) {
+            if (offset < static_cast<std::int64_t>(sizeof(DeltaLogHeader))) {
+                return false;
+            }
+            std::uint64_t body = static_cast<std::uint64_t>(offset) - sizeof(DeltaLogHeader);
+            return body % sizeof(DeltaRecord) == 0 &&
+                   static_cast<std::size_t>(offset) + sizeof(DeltaRecord) <= fileSize;
+        }
+    }  // namespace
+
+    // ========== Writer ==========
+
+    RatingDeltaLog::Writer::Writer()
+        : file(nullptr)
+        , endOffset(0) {
+    }
+
+    RatingDeltaLog::Writer::~Writer() {
+        Close();
+    }
+
+    bool RatingDeltaLog::Writer::Open(const std::string& logPath) {
+        Close();
+        path = logPath;
+        tailOffsets.clear();
+        chunk.clear();
+        chunk.reserve(kWriteChunkRecords);
+
+        // Scan an existing log once to rebuild the chain tails, so
+        // reopened logs keep their chains intact
+        std::FILE* existing = std::fopen(path.c_str(), "rb");
+        if (existing != nullptr) {
+            DeltaLogHeader header;
+            bool headerOk =
+                std::fread(&header, sizeof(header), 1, existing) == 1 &&
+                header.magic == kDeltaLogMagic &&
+                header.version == kFormatVersion;
+
+            if (!headerOk) {
+                std::fclose(existing);
+                return false;
+            }
+
+            std::uint64_t offset = sizeof(DeltaLogHeader);
+            DeltaRecord record;
+            while (std::fread(&record, sizeof(record), 1, existing) == 1) {
+                tailOffsets[record.playerId] = static_cast<std::int64_t>(offset);
+                offset += sizeof(DeltaRecord);
+            }
+            std::fseek(existing, 0, SEEK_END);
+            long actualSize = std::ftell(existing);
+            std::fclose(existing);
+
+            // A crash mid-write can leave a torn record past the last
+            // whole one the scan counted; cut the file back to that
+            // boundary, or appends would land after the partial bytes
+            // and corrupt every prevOffset chain from here on
+            if (actualSize < 0) {
+                return false;
+            }
+            if (static_cast<std::uint64_t>(actualSize) > offset) {
+#ifndef _WIN32
+                if (::truncate(path.c_str(), static_cast<off_t>(offset)) != 0) {
+                    return false;
+                }
+#else
+                std::FILE* fixup = std::fopen(path.c_str(), "r+b");
+                if (fixup == nullptr) {
+                    return false;
+                }
+                int rc = _chsize_s(_fileno(fixup), static_cast<long long>(offset));
+                std::fclose(fixup);
+                if (rc != 0) {
+                    return false;
+                }
+#endif
+            }
+
+            endOffset = offset;
+            file = std::fopen(path.c_str(), "ab");
+            return file != nullptr;
+        }
+
+        // Fresh log: write the header
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        DeltaLogHeader header;
+        header.magic = kDeltaLogMagic;
+        header.version = kFormatVersion;
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+            std::fclose(file);
+            file = nullptr;
+            return false;
+        }
+
+        endOffset = sizeof(DeltaLogHeader);
+        return true;
+    }
+
+    bool RatingDeltaLog::Writer::Append(
+        std::uint64_t matchId,
+        std::uint64_t playerId,
+        const PlayerRating& before,
+        const PlayerRating& after) {
+        if (file == nullptr) {
+            return false;
+        }
+
+        DeltaRecord record;
+        record.matchId = matchId;
+        record.playerId = playerId;
+        record.muBefore = before.GetMu();
+        record.phiBefore = before.GetPhi();
+        record.sigmaBefore = before.GetSigma();
+        record.muAfter = after.GetMu();
+        record.phiAfter = after.GetPhi();
+        record.sigmaAfter = after.GetSigma();
+
+        // Link into the player's chain and become its new tail
+        auto it = tailOffsets.find(playerId);
+        record.prevOffset = it != tailOffsets.end() ? it->second : -1;
+        tailOffsets[playerId] = static_cast<std::int64_t>(endOffset);
+
+        chunk.push_back(record);
+        endOffset += sizeof(DeltaRecord);
+
+        if (chunk.size() >= kWriteChunkRecords) {
+            return Flush();
+        }
+        return true;
+    }
+
+    bool RatingDeltaLog::Writer::Flush() {
+        if (file == nullptr) {
+            return false;
+        }
+        if (chunk.empty()) {
+            return true;
+        }
+
+        bool ok = std::fwrite(chunk.data(), sizeof(DeltaRecord),
+                              chunk.size(), file) == chunk.size();
+        chunk.clear();
+        return ok && std::fflush(file) == 0;
+    }
+
+    bool RatingDeltaLog::Writer::Close() {
+        if (file == nullptr) {
+            return false;
+        }
+
+        bool ok = Flush();
+        if (std::fclose(file) != 0) {
+            ok = false;
+        }
+        file = nullptr;
+
+        if (!ok) {
+            return false;
+        }
+
+        // Write the side index of chain tails so readers skip the scan
+        std::FILE* indexFile = std::fopen(IndexPathFor(path).c_str(), "wb");
+        if (indexFile == nullptr) {
+            return false;
+        }
+
+        DeltaIndexHeader header;
+        header.magic = kDeltaIndexMagic;
+        header.version = kFormatVersion;
+        header.entryCount = tailOffsets.size();
+        header.recordCount = (endOffset - sizeof(DeltaLogHeader)) / sizeof(DeltaRecord);
+        ok = std::fwrite(&header, sizeof(header), 1, indexFile) == 1;
+
+        for (auto it = tailOffsets.begin(); ok && it != tailOffsets.end(); ++it) {
+            DeltaIndexEntry entry;
+            entry.playerId = it->first;
+            entry.tailOffset = it->second;
+            ok = std::fwrite(&entry, sizeof(entry), 1, indexFile) == 1;
+        }
+
+        if (std::fclose(indexFile) != 0) {
+            ok = false;
+        }
+        return ok;
+    }
+
+    // ========== Reader ==========
+
+    RatingDeltaLog::Reader::Reader()
+        : base(nullptr)
+        , fileSize(0)
+        , recordCount(0)
+        , mapping(nullptr) {
+    }
+
+    RatingDeltaLog::Reader::~Reader() {
+        Close();
+    }
+
+    bool RatingDeltaLog::Reader::Open(const std::string& path) {
+        Close();
+
+#ifndef _WIN32
+        // Map the file read-only; records are then consumed in place
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size < 0) {
+            ::close(fd);
+            return false;
+        }
+        fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+        void* mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // Mapping keeps its own reference
+        if (mapped == MAP_FAILED) {
+            fileSize = 0;
+            return false;
+        }
+
+        mapping = mapped;
+        base = static_cast<const char*>(mapped);
+#else
+        // Fallback: read the whole file into memory
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        std::fseek(file, 0, SEEK_END);
+        long size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        if (size < 0) {
+            std::fclose(file);
+            return false;
+        }
+
+        fileSize = static_cast<std::size_t>(size);
+        fallbackBuffer.resize(fileSize);
+        bool readOk = fileSize == 0 ||
+            std::fread(fallbackBuffer.data(), 1, fileSize, file) == fileSize;
+        std::fclose(file);
+        if (!readOk) {
+            fallbackBuffer.clear();
+            fileSize = 0;
+            return false;
+        }
+
+        base = fallbackBuffer.data();
+#endif
+
+        // Validate header and derive the record count from the length
+        if (fileSize < sizeof(DeltaLogHeader)) {
+            Close();
+            return false;
+        }
+
+        DeltaLogHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        if (header.magic != kDeltaLogMagic || header.version != kFormatVersion) {
+            Close();
+            return false;
+        }
+
+        recordCount = (fileSize - sizeof(DeltaLogHeader)) / sizeof(DeltaRecord);
+
+        // Prefer the side index; fall back to one sequential scan if it
+        // is absent or does not match the log's current length
+        std::FILE* indexFile = std::fopen(IndexPathFor(path).c_str(), "rb");
+        if (indexFile != nullptr) {
+            DeltaIndexHeader indexHeader;
+            bool ok =
+                std::fread(&indexHeader, sizeof(indexHeader), 1, indexFile) == 1 &&
+                indexHeader.magic == kDeltaIndexMagic &&
+                indexHeader.version == kFormatVersion &&
+                indexHeader.recordCount == recordCount;
+
+            if (ok) {
+                tailOffsets.reserve(static_cast<std::size_t>(indexHeader.entryCount));
+                DeltaIndexEntry entry;
+                for (std::uint64_t i = 0; ok && i < indexHeader.entryCount; ++i) {
+                    ok = std::fread(&entry, sizeof(entry), 1, indexFile) == 1 &&
+                         ValidRecordOffset(entry.tailOffset, fileSize);
+                    if (ok) {
+                        tailOffsets[entry.playerId] = entry.tailOffset;
+                    }
+                }
+            }
+
+            std::fclose(indexFile);
+            if (ok) {
+                return true;
+            }
+            tailOffsets.clear();
+        }
+
+        for (std::size_t i = 0; i < recordCount; ++i) {
+            tailOffsets[Record(i).playerId] = static_cast<std::int64_t>(
+                sizeof(DeltaLogHeader) + i * sizeof(DeltaRecord));
+        }
+        return true;
+    }
+
+    void RatingDeltaLog::Reader::Close() {
+#ifndef _WIN32
+        if (mapping != nullptr) {
+            ::munmap(mapping, fileSize);
+        }
+#endif
+        mapping = nullptr;
+        fallbackBuffer.clear();
+        base = nullptr;
+        fileSize = 0;
+        recordCount = 0;
+        tailOffsets.clear();
+    }
+
+    const DeltaRecord& RatingDeltaLog::Reader::Record(std::size_t index) const {
+        return *reinterpret_cast<const DeltaRecord*>(
+            base + sizeof(DeltaLogHeader) + index * sizeof(DeltaRecord));
+    }
+
+    bool RatingDeltaLog::Reader::History(std::uint64_t playerId,
+                                         std::vector<DeltaRecord>& out) const {
+        out.clear();
+
+        auto it = tailOffsets.find(playerId);
+        if (it == tailOffsets.end()) {
+            return false;
+        }
+
+        // Walk the chain backward from the tail; each hop touches only
+        // this player's records
+        std::int64_t offset = it->second;
+        while (offset >= 0 && ValidRecordOffset(offset, fileSize)) {
+            const DeltaRecord* record = reinterpret_cast<const DeltaRecord*>(base + offset);
+            out.push_back(*record);
+
+            // Well-formed writers chain strictly backward; a corrupt
+            // prevOffset pointing forward or at itself would otherwise
+            // walk this loop forever
+            if (record->prevOffset >= offset) {
+                break;
+            }
+            offset = record->prevOffset;
+        }
+
+        std::reverse(out.begin(), out.end());
+        return !out.empty();
+    }
+
+    // ========== Compaction ==========
+
+    bool RatingDeltaLog::Compact(const std::string& inputPath,
+                                 const std::string& outputPath) {
+        Reader reader;
+        if (!reader.Open(inputPath)) {
+            return false;
+        }
+
+        Writer writer;
+        if (!writer.Open(outputPath)) {
+            return false;
+        }
+
+        // Emit each player's chain contiguously, oldest record first;
+        // players are ordered by first appearance so compaction output
+        // is deterministic for a given input
+        std::vector<std::uint64_t> playerOrder;
+        std::unordered_map<std::uint64_t, bool> seen;
+        for (std::size_t i = 0; i < reader.Count(); ++i) {
+            std::uint64_t id = reader.Record(i).playerId;
+            if (!seen[id]) {
+                seen[id] = true;
+                playerOrder.push_back(id);
+            }
+        }
+
+        std::vector<DeltaRecord> history;
+        bool ok = true;
+        for (std::size_t p = 0; ok && p < playerOrder.size(); ++p) {
+            reader.History(playerOrder[p], history);
+            for (const DeltaRecord& record : history) {
+                PlayerRating before;
+                before.SetMu(record.muBefore);
+                before.SetPhi(record.phiBefore);
+                before.SetSigma(record.sigmaBefore);
+
+                PlayerRating after;
+                after.SetMu(record.muAfter);
+                after.SetPhi(record.phiAfter);
+                after.SetSigma(record.sigmaAfter);
+
+                ok = writer.Append(record.matchId, record.playerId, before, after);
+                if (!ok) {
+                    break;
+                }
+            }
+        }
+
+        return writer.Close() && ok;
+    }
+
+}  // namespace TeamGlicko2
@@ -0,0 +1,155 @@
+#include "RatingKernels.h"
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace TeamGlicko2 {
+    namespace {
+        /// Grid sizing for the sigmoid lookup table
+        /// sigmoid(±10) is within 5e-5 of its 0/1 limit, so saturating
+        /// outside [-10, 10] is already inside the error budget; 2048
+        /// intervals over that range bound the linear-interpolation
+        /// error by h^2/8 * max|sigmoid''| ~= 1.2e-6
+        const std::size_t kSigmoidTableIntervals = 2048;
+        const double kSigmoidTableMaxX = 10.0;
+
+        /// Precomputed sigmoid samples over [-maxX, maxX]
+        struct SigmoidTable {
+            double values[kSigmoidTableIntervals + 1];
+            double invStep;
+
+            SigmoidTable() {
+                double step = 2.0 * kSigmoidTableMaxX / kSigmoidTableIntervals;
+                invStep = 1.0 / step;
+                for (std::size_t i = 0; i <= kSigmoidTableIntervals; ++i) {
+                    double x = -kSigmoidTableMaxX + i * step;
+                    values[i] = 1.0 / (1.0 + std::exp(-x));
+                }
+            }
+        };
+
+        /// Built once on first use (thread-safe magic static)
+        const SigmoidTable& Sigmoid() {
+            static const SigmoidTable table;
+            return table;
+        }
+
+        /// Interpolated sigmoid(x), saturating outside the grid
+        inline double LookupSigmoid(const SigmoidTable& table, double x) {
+            if (x <= -kSigmoidTableMaxX) {
+                return table.values[0];
+            }
+            if (x >= kSigmoidTableMaxX) {
+                return table.values[kSigmoidTableIntervals];
+            }
+            double position = (x + kSigmoidTableMaxX) * table.invStep;
+            std::size_t index = static_cast<std::size_t>(position);
+            double frac = position - static_cast<double>(index);
+            return table.values[index]
+                 + frac * (table.values[index + 1] - table.values[index]);
+        }
+    }  // namespace
+
+    void RatingKernels::ComputeGs(const double* phi, double* out, std::size_t n) {
+        // g(phi) = 1 / sqrt(1 + 3*phi^2 / pi^2)
+        const double threeOverPiSquared = 3.0 / (M_PI * M_PI);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = 1.0 / std::sqrt(1.0 + threeOverPiSquared * phi[i] * phi[i]);
+        }
+    }
+
+    void RatingKernels::ComputeExpectedScores(
+        const double* mu,
+        double muOpp,
+        double gOpp,
+        double* out,
+        std::size_t n) {
+        // E_i = 1 / (1 + exp(-gOpp * (mu_i - muOpp)))
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = 1.0 / (1.0 + std::exp(-gOpp * (mu[i] - muOpp)));
+        }
+    }
+
+    void RatingKernels::ComputeExpectedScores(
+        const double* mu,
+        const double* phi,
+        double muOpp,
+        double* out,
+        std::size_t n) {
+        const double threeOverPiSquared = 3.0 / (M_PI * M_PI);
+
+        // E_i = 1 / (1 + exp(-g(phi_i) * (mu_i - muOpp)))
+        for (std::size_t i = 0; i < n; ++i) {
+            double g = 1.0 / std::sqrt(1.0 + threeOverPiSquared * phi[i] * phi[i]);
+            out[i] = 1.0 / (1.0 + std::exp(-g * (mu[i] - muOpp)));
+        }
+    }
+
+    double RatingKernels::FastExpectedScore(double mu, double muOpp, double gOpp) {
+        return LookupSigmoid(Sigmoid(), gOpp * (mu - muOpp));
+    }
+
+    void RatingKernels::FastExpectedScores(
+        const double* mu,
+        double muOpp,
+        double gOpp,
+        double* out,
+        std::size_t n) {
+        const SigmoidTable& table = Sigmoid();
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = LookupSigmoid(table, gOpp * (mu[i] - muOpp));
+        }
+    }
+
+    void RatingKernels::ComputeMoments(
+        const double* scores,
+        std::size_t n,
+        double& outMean,
+        double& outVariance) {
+        outMean = 0.0;
+        outVariance = 0.0;
+        if (n == 0) {
+            return;
+        }
+
+        // Welford's online update: one pass accumulates both the running
+        // mean and the sum of squared differences M2
+        double mean = 0.0;
+        double m2 = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            double delta = scores[i] - mean;
+            mean += delta / static_cast<double>(i + 1);
+            m2 += delta * (scores[i] - mean);
+        }
+
+        outMean = mean;
+        outVariance = m2 / static_cast<double>(n);
+    }
+
+    void RatingKernels::WriteZScores(
+        const double* scores,
+        std::size_t n,
+        double mean,
+        double stddev,
+        double maxZScore,
+        double* outZ) {
+        if (maxZScore <= 0.0) {
+            for (std::size_t i = 0; i < n; ++i) {
+                outZ[i] = (scores[i] - mean) / stddev;
+            }
+            return;
+        }
+
+        // Clipping folded into the same loop; min/max compile to
+        // branch-free vector instructions
+        for (std::size_t i = 0; i < n; ++i) {
+            double z = (scores[i] - mean) / stddev;
+            outZ[i] = std::max(-maxZScore, std::min(z, maxZScore));
+        }
+    }
+
+}  // namespace TeamGlicko2
@@ -0,0 +1,205 @@
+#include "RatingSimulator.h"
+
+#include <chrono>
+#include <cmath>
+#include <random>
+
+#include "RatingStore.h"
+#include "TeamBalancer.h"
+#include "TeamGlicko2System.h"
+
+namespace TeamGlicko2 {
+    namespace {
+        /// Deterministic random helpers over mt19937_64 raw output
+        /// mt19937_64's bit stream is specified by the standard; only
+        /// the distribution adapters are implementation-defined, so
+        /// these transforms keep runs identical across toolchains
+        struct SimRng {
+            std::mt19937_64 engine;
+
+            explicit SimRng(std::uint64_t seed) : engine(seed) {}
+
+            /// Uniform double in [0, 1)
+            double Uniform() {
+                return (engine() >> 11) * (1.0 / 9007199254740992.0);
+            }
+
+            /// Standard normal via Box-Muller
+            double Normal() {
+                double u1 = Uniform();
+                double u2 = Uniform();
+                // Guard the log against a zero draw
+                if (u1 <= 0.0) {
+                    u1 = 1.0 / 9007199254740992.0;
+                }
+                const double twoPi = 6.28318530717958647692;
+                return std::sqrt(-2.0 * std::log(u1)) * std::cos(twoPi * u2);
+            }
+
+            /// Uniform integer in [0, bound)
+            std::size_t Below(std::size_t bound) {
+                return static_cast<std::size_t>(Uniform() * bound);
+            }
+        };
+
+        /// RMSE of current ratings against latent skills, plus mean RD
+        void EvaluatePopulation(const RatingStore& store,
+                                const std::vector<double>& latent,
+                                double& outRMSE, double& outMeanRD) {
+            double squaredError = 0.0;
+            double rdSum = 0.0;
+            std::size_t n = store.Size();
+            for (std::size_t i = 0; i < n; ++i) {
+                PlayerRating rating = store.Get(static_cast<PlayerHandle>(i));
+                double error = rating.GetRating() - latent[i];
+                squaredError += error * error;
+                rdSum += rating.GetRD();
+            }
+            outRMSE = n > 0 ? std::sqrt(squaredError / n) : 0.0;
+            outMeanRD = n > 0 ? rdSum / n : 0.0;
+        }
+    }  // namespace
+
+    SimulationReport RatingSimulator::Run(const SimulationConfig& config) {
+        SimulationReport report;
+        report.finalRMSE = 0.0;
+        report.finalMeanRD = 0.0;
+        report.matchesPerSecond = 0.0;
+        report.elapsedNanos = 0;
+        report.matchesPlayed = 0;
+
+        std::size_t lobbySize = config.lobbySize >= 2 ? config.lobbySize : 2;
+        if (config.playerCount < lobbySize || config.matchCount == 0) {
+            return report;
+        }
+
+        SimRng rng(config.seed);
+
+        // Population: latent skills are the ground truth the rating
+        // system is trying to recover; everyone starts at the defaults
+        std::vector<double> latent(config.playerCount);
+        RatingStore store;
+        for (std::size_t i = 0; i < config.playerCount; ++i) {
+            latent[i] = config.latentMean + config.latentStddev * rng.Normal();
+            store.Add();
+        }
+
+        std::size_t checkpointCount = config.checkpointCount > 0
+                                    ? config.checkpointCount : 1;
+        std::size_t checkpointStride = config.matchCount / checkpointCount;
+        if (checkpointStride == 0) {
+            checkpointStride = 1;
+        }
+
+        std::vector<PlayerInfo> lobby;
+        lobby.reserve(lobbySize);
+        std::vector<std::size_t> drawn;
+        drawn.reserve(lobbySize);
+        MatchResult result;
+        MatchScratch scratch;
+        BalancerConfig balancerConfig;
+
+        std::int64_t computeNanos = 0;
+        auto segmentStart = std::chrono::steady_clock::now();
+
+        for (std::size_t m = 0; m < config.matchCount; ++m) {
+            // Draw a lobby of distinct players
+            drawn.clear();
+            while (drawn.size() < lobbySize) {
+                std::size_t candidate = rng.Below(config.playerCount);
+                bool duplicate = false;
+                for (std::size_t seen : drawn) {
+                    if (seen == candidate) {
+                        duplicate = true;
+                        break;
+                    }
+                }
+                if (!duplicate) {
+                    drawn.push_back(candidate);
+                }
+            }
+
+            lobby.clear();
+            for (std::size_t playerIndex : drawn) {
+                lobby.emplace_back(static_cast<int>(playerIndex),
+                                   store.Get(static_cast<PlayerHandle>(playerIndex)));
+            }
+
+            TeamAssignment assignment = TeamBalancer::BalanceTeams(lobby, balancerConfig);
+
+            // Decide the outcome from the latent skills with an
+            // Elo-style logistic on the average latent difference
+            double latentA = 0.0;
+            for (int id : assignment.team0PlayerIds) {
+                latentA += latent[static_cast<std::size_t>(id)];
+            }
+            double latentB = 0.0;
+            for (int id : assignment.team1PlayerIds) {
+                latentB += latent[static_cast<std::size_t>(id)];
+            }
+            double avgDiff = latentA / assignment.team0PlayerIds.size()
+                           - latentB / assignment.team1PlayerIds.size();
+            double winProbA = 1.0 / (1.0 + std::pow(10.0, -avgDiff / config.outcomeScale));
+            bool teamAWins = rng.Uniform() < winProbA;
+
+            // Per-match performance: latent skill plus noise, floored
+            // like the raw-stat formula so scores stay positive
+            result.teamA.clear();
+            result.teamB.clear();
+            result.scoreA = teamAWins ? kWinScore : kLossScore;
+            result.scoreB = teamAWins ? kLossScore : kWinScore;
+            for (int id : assignment.team0PlayerIds) {
+                std::size_t playerIndex = static_cast<std::size_t>(id);
+                double perf = latent[playerIndex]
+                            + config.perfNoiseStddev * rng.Normal();
+                result.teamA.emplace_back(
+                    store.Get(static_cast<PlayerHandle>(playerIndex)),
+                    perf > 100.0 ? perf : 100.0, id);
+            }
+            for (int id : assignment.team1PlayerIds) {
+                std::size_t playerIndex = static_cast<std::size_t>(id);
+                double perf = latent[playerIndex]
+                            + config.perfNoiseStddev * rng.Normal();
+                result.teamB.emplace_back(
+                    store.Get(static_cast<PlayerHandle>(playerIndex)),
+                    perf > 100.0 ? perf : 100.0, id);
+            }
+
+            TeamGlicko2System::ProcessMatch(result, scratch);
+
+            for (const MatchPlayer& player : result.teamA) {
+                store.Set(static_cast<PlayerHandle>(player.playerId), player.rating);
+            }
+            for (const MatchPlayer& player : result.teamB) {
+                store.Set(static_cast<PlayerHandle>(player.playerId), player.rating);
+            }
+            report.matchesPlayed++;
+
+            // Checkpoint evaluation runs off the throughput clock
+            if (report.matchesPlayed % checkpointStride == 0 ||
+                report.matchesPlayed == config.matchCount) {
+                auto segmentEnd = std::chrono::steady_clock::now();
+                computeNanos += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    segmentEnd - segmentStart).count();
+
+                SimulationCheckpoint checkpoint;
+                checkpoint.matchesPlayed = report.matchesPlayed;
+                EvaluatePopulation(store, latent,
+                                   checkpoint.rmse, checkpoint.meanRD);
+                report.checkpoints.push_back(checkpoint);
+
+                segmentStart = std::chrono::steady_clock::now();
+            }
+        }
+
+        report.finalRMSE = report.checkpoints.back().rmse;
+        report.finalMeanRD = report.checkpoints.back().meanRD;
+        report.elapsedNanos = computeNanos;
+        if (computeNanos > 0) {
+            report.matchesPerSecond = report.matchesPlayed
+                                    * 1e9 / static_cast<double>(computeNanos);
+        }
+        return report;
+    }
+
+}  // namespace TeamGlicko2
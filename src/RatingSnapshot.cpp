@@ -0,0 +1,212 @@
+#include "RatingSnapshot.h"
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace TeamGlicko2 {
+    namespace {
+        /// 'TGRS' - TeamGlicko2 Rating Snapshot
+        const std::uint32_t kSnapshotMagic = 0x53524754u;
+
+        /// Records are staged through a buffer of this many entries so
+        /// the write path is one buffered streaming pass
+        const std::size_t kWriteChunkRecords = 4096;
+    }  // namespace
+
+    bool RatingSnapshot::Write(
+        const std::string& path,
+        const RatingStore& store,
+        const std::vector<std::uint64_t>& playerIds) {
+        if (playerIds.size() != store.Size()) {
+            return false;
+        }
+
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        SnapshotHeader header;
+        header.magic = kSnapshotMagic;
+        header.version = kFormatVersion;
+        header.recordCount = store.Size();
+
+        bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+        std::vector<SnapshotRecord> chunk;
+        chunk.reserve(kWriteChunkRecords);
+
+        for (std::size_t i = 0; ok && i < store.Size(); ++i) {
+            PlayerHandle handle = static_cast<PlayerHandle>(i);
+
+            SnapshotRecord record;
+            record.playerId = playerIds[i];
+            record.mu = store.GetMu(handle);
+            record.phi = store.GetPhi(handle);
+            record.sigma = store.GetSigma(handle);
+            record.perfIndexEMA = store.GetPerfIndexEMA(handle);
+            record.perfGames = store.GetPerfGames(handle);
+            record.reserved = 0;
+            chunk.push_back(record);
+
+            if (chunk.size() == kWriteChunkRecords) {
+                ok = std::fwrite(chunk.data(), sizeof(SnapshotRecord),
+                                 chunk.size(), file) == chunk.size();
+                chunk.clear();
+            }
+        }
+
+        if (ok && !chunk.empty()) {
+            ok = std::fwrite(chunk.data(), sizeof(SnapshotRecord),
+                             chunk.size(), file) == chunk.size();
+        }
+
+        if (std::fclose(file) != 0) {
+            ok = false;
+        }
+
+        return ok;
+    }
+
+    bool RatingSnapshot::Load(
+        const std::string& path,
+        RatingStore& store,
+        std::vector<std::uint64_t>& outPlayerIds) {
+        View view;
+        if (!view.Open(path)) {
+            return false;
+        }
+
+        store.Clear();
+        store.Reserve(view.Count());
+        outPlayerIds.clear();
+        outPlayerIds.reserve(view.Count());
+
+        for (std::size_t i = 0; i < view.Count(); ++i) {
+            const SnapshotRecord& record = view.Record(i);
+
+            PlayerHandle handle = store.Add();
+            store.SetMu(handle, record.mu);
+            store.SetPhi(handle, record.phi);
+            store.SetSigma(handle, record.sigma);
+            store.SetPerfIndexEMA(handle, record.perfIndexEMA);
+            store.SetPerfGames(handle, record.perfGames);
+            outPlayerIds.push_back(record.playerId);
+        }
+
+        return true;
+    }
+
+    RatingSnapshot::View::View()
+        : records(nullptr)
+        , recordCount(0)
+        , mapping(nullptr)
+        , mappingSize(0) {
+    }
+
+    RatingSnapshot::View::~View() {
+        Close();
+    }
+
+    bool RatingSnapshot::View::Open(const std::string& path) {
+        Close();
+
+        const char* base = nullptr;
+        std::size_t fileSize = 0;
+
+#ifndef _WIN32
+        // Map the file read-only; records are then consumed in place
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size < 0) {
+            ::close(fd);
+            return false;
+        }
+        fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+        void* mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // Mapping keeps its own reference
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+
+        mapping = mapped;
+        mappingSize = fileSize;
+        base = static_cast<const char*>(mapped);
+#else
+        // Fallback: read the whole file into memory
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+
+        std::fseek(file, 0, SEEK_END);
+        long size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        if (size < 0) {
+            std::fclose(file);
+            return false;
+        }
+
+        fileSize = static_cast<std::size_t>(size);
+        fallbackBuffer.resize(fileSize);
+        bool readOk = fileSize == 0 ||
+            std::fread(fallbackBuffer.data(), 1, fileSize, file) == fileSize;
+        std::fclose(file);
+        if (!readOk) {
+            fallbackBuffer.clear();
+            return false;
+        }
+
+        base = fallbackBuffer.data();
+#endif
+
+        // Validate header and record array bounds
+        if (fileSize < sizeof(SnapshotHeader)) {
+            Close();
+            return false;
+        }
+
+        SnapshotHeader header;
+        std::memcpy(&header, base, sizeof(header));
+
+        // Division form: recordCount comes from the file, so the
+        // multiplied comparison could wrap on a corrupt count and pass
+        if (header.magic != kSnapshotMagic ||
+            header.version != kFormatVersion ||
+            header.recordCount >
+                (fileSize - sizeof(SnapshotHeader)) / sizeof(SnapshotRecord)) {
+            Close();
+            return false;
+        }
+
+        records = reinterpret_cast<const SnapshotRecord*>(base + sizeof(SnapshotHeader));
+        recordCount = static_cast<std::size_t>(header.recordCount);
+        return true;
+    }
+
+    void RatingSnapshot::View::Close() {
+#ifndef _WIN32
+        if (mapping != nullptr) {
+            ::munmap(mapping, mappingSize);
+        }
+#endif
+        mapping = nullptr;
+        mappingSize = 0;
+        fallbackBuffer.clear();
+        records = nullptr;
+        recordCount = 0;
+    }
+
+}  // namespace TeamGlicko2
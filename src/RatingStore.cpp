@@ -0,0 +1,142 @@
+#include "RatingStore.h"
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace TeamGlicko2 {
+    namespace {
+        /// Decay one contiguous slice of the phi column
+        /// Returns the number of players touched in the slice
+        std::size_t DecaySlice(double* phi, const double* sigma,
+                               const ActivityInfo* activity,
+                               std::size_t begin, std::size_t end) {
+            const double maxPhi = TeamGlicko2::kMaxRD / TeamGlicko2::kScale;
+            std::size_t touched = 0;
+
+            for (std::size_t i = begin; i < end; ++i) {
+                // Skip active players and players already at the ceiling
+                if (activity[i].roundsInPastDays >= TeamGlicko2::kMinRoundsForActivity ||
+                    phi[i] >= maxPhi) {
+                    continue;
+                }
+
+                int inactivePeriods = static_cast<int>(
+                    activity[i].deltaDays / TeamGlicko2::kDaysPerRatingPeriod);
+                if (inactivePeriods < 1) {
+                    continue;
+                }
+
+                // Standard Glicko-2 decay, once per inactive period:
+                // phi' = sqrt(phi^2 + sigma^2), capped at kMaxRD
+                double phiValue = phi[i];
+                double sigmaSquared = sigma[i] * sigma[i];
+                for (int period = 0; period < inactivePeriods; ++period) {
+                    phiValue = std::sqrt(phiValue * phiValue + sigmaSquared);
+                    if (phiValue >= maxPhi) {
+                        phiValue = maxPhi;
+                        break;  // Already at maximum, no need to continue
+                    }
+                }
+
+                phi[i] = phiValue;
+                touched++;
+            }
+
+            return touched;
+        }
+    }  // namespace
+
+    PlayerHandle RatingStore::Add() {
+        return Add(PlayerRating());
+    }
+
+    PlayerHandle RatingStore::Add(const PlayerRating& rating) {
+        PlayerHandle handle = static_cast<PlayerHandle>(mu.size());
+
+        mu.push_back(rating.GetMu());
+        phi.push_back(rating.GetPhi());
+        sigma.push_back(rating.GetSigma());
+        perfIndexEMA.push_back(rating.GetPerfIndexEMA());
+        perfGames.push_back(rating.GetPerfGames());
+
+        return handle;
+    }
+
+    void RatingStore::Reserve(std::size_t capacity) {
+        mu.reserve(capacity);
+        phi.reserve(capacity);
+        sigma.reserve(capacity);
+        perfIndexEMA.reserve(capacity);
+        perfGames.reserve(capacity);
+    }
+
+    void RatingStore::Clear() {
+        mu.clear();
+        phi.clear();
+        sigma.clear();
+        perfIndexEMA.clear();
+        perfGames.clear();
+    }
+
+    PlayerRating RatingStore::Get(PlayerHandle handle) const {
+        PlayerRating rating;
+        rating.SetMu(mu[handle]);
+        rating.SetPhi(phi[handle]);
+        rating.SetSigma(sigma[handle]);
+        rating.SetPerfIndexEMA(perfIndexEMA[handle]);
+        rating.SetPerfGames(perfGames[handle]);
+        return rating;
+    }
+
+    std::size_t RatingStore::DecaySweep(const ActivityInfo* activity, std::size_t n,
+                                        std::size_t numThreads) {
+        if (n != Size() || n == 0) {
+            return 0;
+        }
+
+        if (numThreads <= 1 || n < 1024) {
+            return DecaySlice(phi.data(), sigma.data(), activity, 0, n);
+        }
+
+        // Split the columns into contiguous slices, one per worker;
+        // slices are disjoint so no synchronization is needed beyond
+        // the joins
+        std::size_t workerCount = numThreads < n ? numThreads : n;
+        std::vector<std::size_t> touchedPerWorker(workerCount, 0);
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+
+        std::size_t sliceSize = (n + workerCount - 1) / workerCount;
+        for (std::size_t w = 0; w < workerCount; ++w) {
+            std::size_t begin = w * sliceSize;
+            std::size_t end = begin + sliceSize < n ? begin + sliceSize : n;
+            if (begin >= end) {
+                break;
+            }
+
+            workers.emplace_back([this, activity, begin, end, w, &touchedPerWorker]() {
+                touchedPerWorker[w] = DecaySlice(
+                    phi.data(), sigma.data(), activity, begin, end);
+            });
+        }
+
+        std::size_t touched = 0;
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (std::size_t count : touchedPerWorker) {
+            touched += count;
+        }
+
+        return touched;
+    }
+
+    void RatingStore::Set(PlayerHandle handle, const PlayerRating& rating) {
+        mu[handle] = rating.GetMu();
+        phi[handle] = rating.GetPhi();
+        sigma[handle] = rating.GetSigma();
+        perfIndexEMA[handle] = rating.GetPerfIndexEMA();
+        perfGames[handle] = rating.GetPerfGames();
+    }
+
+}  // namespace TeamGlicko2
@@ -0,0 +1,221 @@
+#include "ShardedRecompute.h"
+
+#include <cmath>
+
+#include "PerformanceWeighting.h"
+#include "RatingSnapshot.h"
+
+namespace TeamGlicko2 {
+    namespace {
+        /// splitmix64 finalizer (same mix as ConcurrentRatingTable):
+        /// cheap and avalanches sequential ids
+        std::uint64_t MixId(std::uint64_t id) {
+            std::uint64_t h = id + 0x9E3779B97F4A7C15ull;
+            h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+            h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+            return h ^ (h >> 31);
+        }
+
+        /// Whether any roster member falls outside the given shard
+        bool TeamSpansShards(const std::vector<MatchPlayer>& team,
+                             std::size_t shard, std::size_t shardCount) {
+            for (const MatchPlayer& player : team) {
+                std::uint64_t id = static_cast<std::uint64_t>(player.playerId);
+                if (ShardedRecompute::ShardOf(id, shardCount) != shard) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }  // namespace
+
+    std::size_t ShardedRecompute::ShardOf(std::uint64_t playerId,
+                                          std::size_t shardCount) {
+        if (shardCount <= 1) {
+            return 0;
+        }
+        return static_cast<std::size_t>(MixId(playerId) % shardCount);
+    }
+
+    void ShardedRecompute::PartitionMatches(
+        const std::vector<MatchResult>& matches,
+        std::size_t shardCount,
+        std::vector<std::vector<std::size_t>>& outLocalMatches,
+        std::vector<std::size_t>& outCrossMatches) {
+        outLocalMatches.assign(shardCount > 0 ? shardCount : 1,
+                               std::vector<std::size_t>());
+        outCrossMatches.clear();
+
+        for (std::size_t m = 0; m < matches.size(); ++m) {
+            const MatchResult& match = matches[m];
+
+            // Home shard of the first player; the match is local iff
+            // every other member agrees
+            std::size_t home = 0;
+            if (!match.teamA.empty()) {
+                home = ShardOf(static_cast<std::uint64_t>(
+                    match.teamA[0].playerId), shardCount);
+            } else if (!match.teamB.empty()) {
+                home = ShardOf(static_cast<std::uint64_t>(
+                    match.teamB[0].playerId), shardCount);
+            }
+
+            if (TeamSpansShards(match.teamA, home, shardCount) ||
+                TeamSpansShards(match.teamB, home, shardCount)) {
+                outCrossMatches.push_back(m);
+            } else {
+                outLocalMatches[home].push_back(m);
+            }
+        }
+    }
+
+    TeamRatingStats ShardedRecompute::ComputePartialTeamStats(
+        const MatchPlayer* team, std::size_t n,
+        std::size_t shard, std::size_t shardCount) {
+        TeamRatingStats stats;
+
+        double muSum = 0.0;
+        double phiSumSquares = 0.0;
+        int owned = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::uint64_t id = static_cast<std::uint64_t>(team[i].playerId);
+            if (ShardOf(id, shardCount) != shard) {
+                continue;
+            }
+            double phi = team[i].rating.GetPhi();
+            muSum += team[i].rating.GetMu();
+            phiSumSquares += phi * phi;
+            owned++;
+        }
+
+        stats.teamSize = owned;
+        if (owned == 0) {
+            return stats;
+        }
+
+        // Same mean / root-mean-square forms as the full aggregator,
+        // over the owned members only
+        stats.mu = muSum / owned;
+        stats.phi = std::sqrt(phiSumSquares
+                              / (static_cast<double>(owned) * owned));
+        return stats;
+    }
+
+    TeamRatingStats ShardedRecompute::CombineTeamStats(
+        const TeamRatingStats* partials, std::size_t count) {
+        // Invert each partial's mean and RMS back to raw sums, add,
+        // and re-derive the aggregate; the split across shards cancels
+        double muSum = 0.0;
+        double phiSumSquares = 0.0;
+        int members = 0;
+        for (std::size_t k = 0; k < count; ++k) {
+            int n = partials[k].teamSize;
+            if (n == 0) {
+                continue;
+            }
+            muSum += partials[k].mu * n;
+            phiSumSquares += partials[k].phi * partials[k].phi
+                           * (static_cast<double>(n) * n);
+            members += n;
+        }
+
+        TeamRatingStats stats;
+        stats.teamSize = members;
+        if (members == 0) {
+            return stats;
+        }
+
+        stats.mu = muSum / members;
+        stats.phi = std::sqrt(phiSumSquares
+                              / (static_cast<double>(members) * members));
+        return stats;
+    }
+
+    void ShardedRecompute::ProcessCrossShardMatch(
+        MatchResult& match,
+        const TeamRatingStats& statsA,
+        const TeamRatingStats& statsB,
+        std::size_t shard,
+        std::size_t shardCount,
+        MatchScratch& scratch) {
+        if (match.teamA.empty() || match.teamB.empty()) {
+            return;
+        }
+
+        scratch.Clear();
+        for (const MatchPlayer& player : match.teamA) {
+            scratch.teamAPerformance.push_back(player.performanceScore);
+        }
+        for (const MatchPlayer& player : match.teamB) {
+            scratch.teamBPerformance.push_back(player.performanceScore);
+        }
+
+        // Opponent-side terms come from the combined aggregates, not
+        // from the (possibly stale) remote rows in the roster
+        OpponentContext contextA = OpponentContext::FromTeamStats(statsA);
+        OpponentContext contextB = OpponentContext::FromTeamStats(statsB);
+
+        // Z-scores run over the full rosters so they match what an
+        // unsharded pass would compute
+        PerformanceWeighting::ComputeZScores(scratch.teamAPerformance,
+                                             scratch.weightsA);
+        PerformanceWeighting::ComputeZScores(scratch.teamBPerformance,
+                                             scratch.weightsB);
+
+        for (std::size_t i = 0; i < match.teamA.size(); ++i) {
+            std::uint64_t id = static_cast<std::uint64_t>(match.teamA[i].playerId);
+            if (ShardOf(id, shardCount) != shard) {
+                continue;
+            }
+            TeamGlicko2System::UpdatePlayerRatingInPlace(
+                match.teamA[i].rating, contextB, match.scoreA,
+                scratch.weightsA[i].zScore);
+        }
+        for (std::size_t i = 0; i < match.teamB.size(); ++i) {
+            std::uint64_t id = static_cast<std::uint64_t>(match.teamB[i].playerId);
+            if (ShardOf(id, shardCount) != shard) {
+                continue;
+            }
+            TeamGlicko2System::UpdatePlayerRatingInPlace(
+                match.teamB[i].rating, contextA, match.scoreB,
+                scratch.weightsB[i].zScore);
+        }
+    }
+
+    bool ShardedRecompute::MergeShardSnapshots(
+        const std::vector<std::string>& paths,
+        RatingStore& outStore,
+        std::vector<std::uint64_t>& outPlayerIds) {
+        outStore.Clear();
+        outPlayerIds.clear();
+
+        std::size_t shardCount = paths.size();
+        for (std::size_t shard = 0; shard < shardCount; ++shard) {
+            RatingSnapshot::View view;
+            if (!view.Open(paths[shard])) {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < view.Count(); ++i) {
+                const SnapshotRecord& record = view.Record(i);
+
+                // Keep only the players this shard owns; other shards'
+                // snapshots may carry stale ghosts of the same ids
+                if (ShardOf(record.playerId, shardCount) != shard) {
+                    continue;
+                }
+
+                PlayerHandle handle = outStore.Add();
+                outStore.SetMu(handle, record.mu);
+                outStore.SetPhi(handle, record.phi);
+                outStore.SetSigma(handle, record.sigma);
+                outStore.SetPerfIndexEMA(handle, record.perfIndexEMA);
+                outStore.SetPerfGames(handle, record.perfGames);
+                outPlayerIds.push_back(record.playerId);
+            }
+        }
+
+        return true;
+    }
+
+}  // namespace TeamGlicko2
@@ -1,15 +1,46 @@
 #include "TeamBalancer.h"
+#include <chrono>
 #include <set>
-#include <iostream>
 
 namespace TeamGlicko2 {
     TeamAssignment TeamBalancer::BalanceTeams(
         const std::vector<PlayerInfo>& players,
         const BalancerConfig& config) {
+        BalancerStats stats;
+        return BalanceTeams(players, config, stats);
+    }
+
+    TeamAssignment TeamBalancer::BalanceTeams(
+        const std::vector<PlayerInfo>& players,
+        const BalancerConfig& config,
+        BalancerStats& outStats) {
+        // Lvalue callers keep their lobby; the search itself runs on
+        // the rvalue overload over this copy
+        std::vector<PlayerInfo> copy = players;
+        return BalanceTeams(std::move(copy), config, outStats);
+    }
+
+    TeamAssignment TeamBalancer::BalanceTeams(
+        std::vector<PlayerInfo>&& players,
+        const BalancerConfig& config) {
+        BalancerStats stats;
+        return BalanceTeams(std::move(players), config, stats);
+    }
+
+    TeamAssignment TeamBalancer::BalanceTeams(
+        std::vector<PlayerInfo>&& players,
+        const BalancerConfig& config,
+        BalancerStats& outStats) {
+        auto searchStart = std::chrono::steady_clock::now();
+        outStats = BalancerStats();
+
         if (players.size() < 2) {
             // Not enough players to balance
             TeamAssignment empty;
             empty.objectiveValue = 0.0;
+            if (config.statsSink) {
+                config.statsSink(outStats);
+            }
             return empty;
         }
 
@@ -18,51 +49,79 @@ namespace TeamGlicko2 {
         int teamSize = static_cast<int>(players.size()) / 2;
         bool isUnevenTeams = (players.size() % 2 != 0);
 
-        // Calculate effective ratings for all players
-        std::vector<PlayerInfo> sortedPlayers = players;
+        // Calculate effective ratings for all players; the moved-in
+        // vector is sorted in place (no second copy)
+        std::vector<PlayerInfo>& sortedPlayers = players;
         for (auto& player : sortedPlayers) {
             player.effectiveRating = player.rating.ComputeEffectiveRating();
         }
 
         // Sort by effective rating (descending) to identify top-2 players
+        // Uses the values computed above rather than re-deriving them
+        // inside the comparator
         std::sort(sortedPlayers.begin(), sortedPlayers.end(),
-            [&config](const PlayerInfo& a, const PlayerInfo& b) {
-                double ratingA = a.rating.ComputeEffectiveRating();
-                double ratingB = b.rating.ComputeEffectiveRating();
-                return ratingA > ratingB;
+            [](const PlayerInfo& a, const PlayerInfo& b) {
+                return a.effectiveRating > b.effectiveRating;
             });
 
         // Initialize best assignment
         TeamAssignment bestAssignment;
         bestAssignment.objectiveValue = std::numeric_limits<double>::max();
 
-        // Try all valid team combinations
-        std::vector<int> currentTeam0;
-        currentTeam0.reserve(teamSize);
-        int combinationsTried = 0;
+        // Set up the branch-and-bound search context with population
+        // totals and prefix sums over the sorted effective ratings
+        SearchContext context;
+        context.players = &sortedPlayers;
+        context.config = &config;
+        context.teamSize = teamSize;
+        context.totalPlayers = static_cast<int>(sortedPlayers.size());
+        context.totalEffective = 0.0;
+        context.totalRDSquared = 0.0;
+        context.totalPureRating = 0.0;
+        context.team0Effective = 0.0;
+        context.team0RDSquared = 0.0;
+        context.team0PureRating = 0.0;
+        context.team0HasTop1 = false;
+        context.team0HasTop2 = false;
+        context.combinationsTried = 0;
+        context.combinationsPruned = 0;
+
+        context.effectivePrefix.resize(sortedPlayers.size() + 1);
+        context.effectivePrefix[0] = 0.0;
+        for (size_t i = 0; i < sortedPlayers.size(); i++) {
+            double effective = sortedPlayers[i].effectiveRating;
+            double rd = sortedPlayers[i].rating.GetRD();
+            context.effectivePrefix[i + 1] = context.effectivePrefix[i] + effective;
+            context.totalEffective += effective;
+            context.totalRDSquared += rd * rd;
+            context.totalPureRating += sortedPlayers[i].rating.GetRating();
+        }
+
+        context.currentTeam0.reserve(teamSize);
 
         // For uneven teams with putTopPlayerInSmallerTeam enabled:
         // Ensure player 0 (top player) starts in the smaller team (team 0)
         if (isUnevenTeams && config.putTopPlayerInSmallerTeam) {
-            currentTeam0.push_back(0);  // Force top player in smaller team
+            const PlayerInfo& top = sortedPlayers[0];
+            context.currentTeam0.push_back(0);  // Force top player in smaller team
+            context.team0Effective = top.effectiveRating;
+            context.team0RDSquared = top.rating.GetRD() * top.rating.GetRD();
+            context.team0PureRating = top.rating.GetRating();
+            context.team0HasTop1 = true;
         }
 
         int startIndex = (isUnevenTeams && config.putTopPlayerInSmallerTeam) ? 1 : 0;
 
-        GenerateCombinations(
-            sortedPlayers,
-            config,
-            teamSize,
-            startIndex,
-            currentTeam0,
-            bestAssignment,
-            combinationsTried);
-
-        std::cout << "Team balancing complete. Tried " << combinationsTried
-                  << " combinations. Best objective value: "
-                  << bestAssignment.objectiveValue
-                  << " (strength diff: " << bestAssignment.strengthDifference
-                  << ", uncertainty diff: " << bestAssignment.uncertaintyDifference << ")" << std::endl;
+        BranchAndBound(context, startIndex, bestAssignment);
+
+        outStats.combinationsTried = context.combinationsTried;
+        outStats.combinationsPruned = context.combinationsPruned;
+        outStats.elapsedNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - searchStart).count();
+
+        if (config.statsSink) {
+            config.statsSink(outStats);
+        }
 
         return bestAssignment;
     }
@@ -167,105 +226,159 @@ namespace TeamGlicko2 {
         return (hasTop1 && hasTop2);
     }
 
-    void TeamBalancer::GenerateCombinations(
-        const std::vector<PlayerInfo>& players,
-        const BalancerConfig& config,
-        int teamSize,
+    void TeamBalancer::BranchAndBound(
+        SearchContext& context,
         int startIndex,
-        std::vector<int>& currentTeam0,
-        TeamAssignment& bestAssignment,
-        int& combinationsTried) {
-        // Check if we've hit the combination limit
-        if (combinationsTried >= config.maxCombinationsToTry)
+        TeamAssignment& bestAssignment) {
+        const std::vector<PlayerInfo>& players = *context.players;
+        const BalancerConfig& config = *context.config;
+
+        // Safety valve: with pruning the search is exact well past 20
+        // players, but keep the configured hard cap honored
+        if (context.combinationsTried >= config.maxCombinationsToTry)
             return;
 
         // Base case: we've selected enough players for team 0
-        if (static_cast<int>(currentTeam0.size()) == teamSize) {
-            combinationsTried++;
+        if (static_cast<int>(context.currentTeam0.size()) == context.teamSize) {
+            EvaluateLeaf(context, bestAssignment);
+            return;
+        }
 
-            // Check top player constraint
-            if (config.separateTopPlayers && ViolatesTopPlayerConstraint(players, currentTeam0)) {
-                return;  // Skip this combination
-            }
+        // Prune: not enough players left to fill team
+        int needed = context.teamSize - static_cast<int>(context.currentTeam0.size());
+        int remaining = context.totalPlayers - startIndex;
+        if (remaining < needed)
+            return;
+
+        // Bound check: if even the best-case strength difference for any
+        // completion of this partial team already exceeds the incumbent
+        // objective, the whole subtree can be discarded
+        if (bestAssignment.objectiveValue < std::numeric_limits<double>::max() &&
+            StrengthLowerBound(context, startIndex) > bestAssignment.objectiveValue) {
+            context.combinationsPruned++;
+            return;
+        }
 
-            // Create team 1 from remaining players
-            std::set<int> team0Set(currentTeam0.begin(), currentTeam0.end());
-            std::vector<int> team1Indices;
-            for (int i = 0; i < static_cast<int>(players.size()); i++) {
-                if (team0Set.find(i) == team0Set.end()) {
-                    team1Indices.push_back(i);
+        for (int i = startIndex; i < context.totalPlayers; i++) {
+            // Early pruning: if top 2 constraint is enabled and we already have
+            // player 0, skip player 1 (and vice versa)
+            if (config.separateTopPlayers) {
+                if ((context.team0HasTop1 && i == 1) || (context.team0HasTop2 && i == 0)) {
+                    continue;  // Skip this player
                 }
             }
 
-            // Check top player constraint for team 1
-            if (config.separateTopPlayers && ViolatesTopPlayerConstraint(players, team1Indices)) {
-                return;  // Skip this combination
-            }
+            // Add player i to team 0, updating running sums incrementally
+            const PlayerInfo& player = players[i];
+            double rd = player.rating.GetRD();
 
-            // Evaluate this assignment using the objective function
-            double strength0, strength1, uncertainty0, uncertainty1, pureRating0, pureRating1;
-            double objectiveValue = EvaluateAssignment(
-                players, currentTeam0, team1Indices, config.lambda,
-                strength0, strength1, uncertainty0, uncertainty1,
-                pureRating0, pureRating1);
+            context.currentTeam0.push_back(i);
+            context.team0Effective += player.effectiveRating;
+            context.team0RDSquared += rd * rd;
+            context.team0PureRating += player.rating.GetRating();
+            if (i == 0) context.team0HasTop1 = true;
+            if (i == 1) context.team0HasTop2 = true;
 
-            // Update best if this is better (with tie-breaking)
-            bool isBetter = false;
-            if (objectiveValue < bestAssignment.objectiveValue) {
-                isBetter = true;
-            } else if (objectiveValue == bestAssignment.objectiveValue) {
-                // Tie-breaker 1: Prefer smaller pure rating gap
-                double pureRatingDiff = std::abs(pureRating0 - pureRating1);
-                if (pureRatingDiff < bestAssignment.pureRatingDifference) {
-                    isBetter = true;
-                } else if (pureRatingDiff == bestAssignment.pureRatingDifference) {
-                    // Tie-breaker 2: Prefer smaller uncertainty difference
-                    double uncertaintyDiff = std::abs(uncertainty0 - uncertainty1);
-                    if (uncertaintyDiff < bestAssignment.uncertaintyDifference) {
-                        isBetter = true;
-                    }
-                }
-            }
+            BranchAndBound(context, i + 1, bestAssignment);
 
-            if (isBetter) {
-                TeamAssignment newAssignment = CreateAssignment(players, currentTeam0);
-                bestAssignment = newAssignment;
-            }
+            // Remove player i again
+            context.currentTeam0.pop_back();
+            context.team0Effective -= player.effectiveRating;
+            context.team0RDSquared -= rd * rd;
+            context.team0PureRating -= player.rating.GetRating();
+            if (i == 0) context.team0HasTop1 = false;
+            if (i == 1) context.team0HasTop2 = false;
 
-            return;
+            // Check limit after each recursion
+            if (context.combinationsTried >= config.maxCombinationsToTry)
+                return;
         }
+    }
 
-        // Recursive case: try adding each remaining player to team 0
-        int needed = teamSize - static_cast<int>(currentTeam0.size());
-        int remaining = static_cast<int>(players.size()) - startIndex;
+    double TeamBalancer::StrengthLowerBound(const SearchContext& context, int startIndex) {
+        int needed = context.teamSize - static_cast<int>(context.currentTeam0.size());
+        int total = context.totalPlayers;
+
+        // Players are sorted by effective rating (descending), so the
+        // largest possible addition to team 0 is the first `needed`
+        // players of the pool and the smallest is the last `needed`
+        double maxAdd = context.effectivePrefix[startIndex + needed]
+                      - context.effectivePrefix[startIndex];
+        double minAdd = context.effectivePrefix[total]
+                      - context.effectivePrefix[total - needed];
+
+        double low = context.team0Effective + minAdd;
+        double high = context.team0Effective + maxAdd;
+
+        int size0 = context.teamSize;
+        int size1 = total - size0;
+
+        // Strength difference as a function of team 0's final sum s:
+        // f(s) = |s/n0 - (total - s)/n1|, minimized at s* = total*n0/N
+        double sStar = context.totalEffective * size0 / total;
+        if (low <= sStar && sStar <= high) {
+            return 0.0;  // A perfectly balanced completion may exist
+        }
 
-        // Prune: not enough players left to fill team
-        if (remaining < needed)
-            return;
+        double fLow = std::abs(low / size0 - (context.totalEffective - low) / size1);
+        double fHigh = std::abs(high / size0 - (context.totalEffective - high) / size1);
+        return std::min(fLow, fHigh);
+    }
 
-        for (int i = startIndex; i < static_cast<int>(players.size()); i++) {
-            // Early pruning: if top 2 constraint is enabled and we already have
-            // player 0, skip player 1 (and vice versa)
-            if (config.separateTopPlayers && currentTeam0.size() > 0) {
-                bool hasPlayer0 = false;
-                bool hasPlayer1 = false;
-                for (int idx : currentTeam0) {
-                    if (idx == 0) hasPlayer0 = true;
-                    if (idx == 1) hasPlayer1 = true;
-                }
+    void TeamBalancer::EvaluateLeaf(SearchContext& context, TeamAssignment& bestAssignment) {
+        const std::vector<PlayerInfo>& players = *context.players;
+        const BalancerConfig& config = *context.config;
 
-                if ((hasPlayer0 && i == 1) || (hasPlayer1 && i == 0)) {
-                    continue;  // Skip this player
+        context.combinationsTried++;
+
+        // Check top player constraint: team 0 holding both top players is
+        // excluded during branching, so the remaining violation is both
+        // ending up in team 1 (team 0 holding neither)
+        if (config.separateTopPlayers && context.totalPlayers >= 2 &&
+            !context.team0HasTop1 && !context.team0HasTop2) {
+            return;  // Skip this combination
+        }
+
+        // Evaluate the objective directly from the running sums -
+        // team 1's totals are the population totals minus team 0's
+        int size0 = context.teamSize;
+        int size1 = context.totalPlayers - size0;
+
+        double strength0 = context.team0Effective;
+        double strength1 = context.totalEffective - strength0;
+        double uncertainty0 = std::sqrt(context.team0RDSquared);
+        double uncertainty1 = std::sqrt(context.totalRDSquared - context.team0RDSquared);
+        double pureRating0 = context.team0PureRating;
+        double pureRating1 = context.totalPureRating - pureRating0;
+
+        double avgStrength0 = strength0 / size0;
+        double avgStrength1 = strength1 / size1;
+        double avgUncertainty0 = uncertainty0 / std::sqrt(size0);
+        double avgUncertainty1 = uncertainty1 / std::sqrt(size1);
+
+        double objectiveValue = std::abs(avgStrength0 - avgStrength1)
+                              + config.lambda * std::abs(avgUncertainty0 - avgUncertainty1);
+
+        // Update best if this is better (with tie-breaking)
+        bool isBetter = false;
+        if (objectiveValue < bestAssignment.objectiveValue) {
+            isBetter = true;
+        } else if (objectiveValue == bestAssignment.objectiveValue) {
+            // Tie-breaker 1: Prefer smaller pure rating gap
+            double pureRatingDiff = std::abs(pureRating0 - pureRating1);
+            if (pureRatingDiff < bestAssignment.pureRatingDifference) {
+                isBetter = true;
+            } else if (pureRatingDiff == bestAssignment.pureRatingDifference) {
+                // Tie-breaker 2: Prefer smaller uncertainty difference
+                double uncertaintyDiff = std::abs(uncertainty0 - uncertainty1);
+                if (uncertaintyDiff < bestAssignment.uncertaintyDifference) {
+                    isBetter = true;
                 }
             }
+        }
 
-            currentTeam0.push_back(i);
-            GenerateCombinations(players, config, teamSize, i + 1, currentTeam0, bestAssignment, combinationsTried);
-            currentTeam0.pop_back();
-
-            // Check limit after each recursion
-            if (combinationsTried >= config.maxCombinationsToTry)
-                return;
+        if (isBetter) {
+            bestAssignment = CreateAssignment(players, context.currentTeam0);
         }
     }
 
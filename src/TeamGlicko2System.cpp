@@ -1,75 +1,372 @@
 #include "TeamGlicko2System.h"
+#include "Instrumentation.h"
 #include <cmath>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
 namespace TeamGlicko2 {
+    OpponentContext OpponentContext::FromTeamStats(const TeamRatingStats& stats) {
+        OpponentContext context;
+        context.mu = stats.mu;
+        context.phi = stats.phi;
+
+        // g(phi) = 1 / sqrt(1 + 3*phi^2 / pi^2), shared by every player
+        // update against this team
+        double phiSquared = stats.phi * stats.phi;
+        context.g = 1.0 / std::sqrt(1.0 + 3.0 * phiSquared / (M_PI * M_PI));
+
+        return context;
+    }
+
     void TeamGlicko2System::ProcessMatch(MatchResult& match) {
-        // Step 1: Extract player ratings for each team
-        std::vector<PlayerRating> teamARatings;
-        std::vector<PlayerRating> teamBRatings;
-        std::vector<double> teamAPerformance;
-        std::vector<double> teamBPerformance;
+        MatchScratch scratch;
+        ProcessMatch(match, scratch);
+    }
+
+    void TeamGlicko2System::ProcessMatch(MatchResult& match, MatchScratch& scratch) {
+        ProcessMatchSpans(match.teamA.data(), match.teamA.size(),
+                          match.teamB.data(), match.teamB.size(),
+                          match.scoreA, match.scoreB, scratch);
+    }
+
+    void TeamGlicko2System::ProcessMatch(ArenaMatchResult& match, MatchScratch& scratch) {
+        ProcessMatchSpans(match.teamA, match.teamACount,
+                          match.teamB, match.teamBCount,
+                          match.scoreA, match.scoreB, scratch);
+    }
+
+    void TeamGlicko2System::ProcessMatchSpans(
+        MatchPlayer* teamA, size_t teamACount,
+        MatchPlayer* teamB, size_t teamBCount,
+        double scoreA, double scoreB,
+        MatchScratch& scratch) {
+        // Step 1: Gather rating columns for each team
+        // Scratch buffers keep their capacity between matches
+        scratch.Clear();
+
+        for (size_t i = 0; i < teamACount; ++i) {
+            scratch.teamAMu.push_back(teamA[i].rating.GetMu());
+            scratch.teamAPhi.push_back(teamA[i].rating.GetPhi());
+            scratch.teamAPerformance.push_back(teamA[i].performanceScore);
+        }
+
+        for (size_t i = 0; i < teamBCount; ++i) {
+            scratch.teamBMu.push_back(teamB[i].rating.GetMu());
+            scratch.teamBPhi.push_back(teamB[i].rating.GetPhi());
+            scratch.teamBPerformance.push_back(teamB[i].performanceScore);
+        }
+
+        // Step 2: Compute team aggregated ratings and the per-team
+        // opponent contexts (g(phi_opp) computed once per team); the
+        // gathered columns make the aggregation a dense reduction
+        OpponentContext contextA;
+        OpponentContext contextB;
+        {
+            TEAMGLICKO2_INSTRUMENT_STAGE(aggregation);
+            TeamRatingStats statsA = TeamRatingAggregator::ComputeTeamStats(
+                scratch.teamAMu.data(), scratch.teamAPhi.data(), teamACount);
+            TeamRatingStats statsB = TeamRatingAggregator::ComputeTeamStats(
+                scratch.teamBMu.data(), scratch.teamBPhi.data(), teamBCount);
+            contextA = OpponentContext::FromTeamStats(statsA);
+            contextB = OpponentContext::FromTeamStats(statsB);
+        }
+
+        // Step 3: Compute performance z-scores for each team
+        {
+            TEAMGLICKO2_INSTRUMENT_STAGE(zScore);
+            PerformanceWeighting::ComputeZScores(scratch.teamAPerformance, scratch.weightsA);
+            PerformanceWeighting::ComputeZScores(scratch.teamBPerformance, scratch.weightsB);
+        }
+
+        {
+            TEAMGLICKO2_INSTRUMENT_STAGE(playerUpdate);
+
+            // Step 4: Update ratings for Team A players (in place; no
+            // temporary PlayerRating per player)
+            for (size_t i = 0; i < teamACount; ++i) {
+                UpdatePlayerRatingInPlace(
+                    teamA[i].rating,
+                    contextB,
+                    scoreA,
+                    scratch.weightsA[i].zScore);
+            }
+
+            // Step 5: Update ratings for Team B players
+            for (size_t i = 0; i < teamBCount; ++i) {
+                UpdatePlayerRatingInPlace(
+                    teamB[i].rating,
+                    contextA,
+                    scoreB,
+                    scratch.weightsB[i].zScore);
+            }
+        }
+
+        TEAMGLICKO2_INSTRUMENT_ADD(matchesProcessed, 1);
+    }
+
+    void TeamGlicko2System::ProcessMultiMatch(MultiMatchResult& match) {
+        MultiMatchScratch scratch;
+        ProcessMultiMatch(match, scratch);
+    }
+
+    void TeamGlicko2System::ProcessMultiMatch(MultiMatchResult& match,
+                                              MultiMatchScratch& scratch) {
+        size_t numTeams = match.teams.size();
+        if (numTeams < 2 || match.placements.size() != numTeams) {
+            return;
+        }
+
+        scratch.Clear();
+        scratch.contexts.resize(numTeams);
+        if (scratch.weights.size() < numTeams) {
+            scratch.weights.resize(numTeams);
+        }
+
+        // Step 1: Aggregate each team and normalize each roster exactly
+        // once; these are shared across all opponent pairings below
+        for (size_t t = 0; t < numTeams; ++t) {
+            scratch.teamMu.clear();
+            scratch.teamPhi.clear();
+            scratch.teamPerformance.clear();
+            for (const auto& player : match.teams[t]) {
+                scratch.teamMu.push_back(player.rating.GetMu());
+                scratch.teamPhi.push_back(player.rating.GetPhi());
+                scratch.teamPerformance.push_back(player.performanceScore);
+            }
+
+            TeamRatingStats stats = TeamRatingAggregator::ComputeTeamStats(
+                scratch.teamMu.data(), scratch.teamPhi.data(), scratch.teamMu.size());
+            scratch.contexts[t] = OpponentContext::FromTeamStats(stats);
+            PerformanceWeighting::ComputeZScores(scratch.teamPerformance, scratch.weights[t]);
+        }
+
+        // Step 2: Update every roster against the precomputed contexts
+        // of all opposing teams with the multi-opponent accumulation
+        for (size_t t = 0; t < numTeams; ++t) {
+            scratch.opponents.clear();
+            scratch.scores.clear();
+            for (size_t o = 0; o < numTeams; ++o) {
+                if (o == t) {
+                    continue;
+                }
+                scratch.opponents.push_back(scratch.contexts[o]);
+                scratch.scores.push_back(match.ScoreAgainst(t, o));
+            }
+
+            for (size_t i = 0; i < match.teams[t].size(); ++i) {
+                UpdatePlayerRatingInPlace(
+                    match.teams[t][i].rating,
+                    scratch.opponents,
+                    scratch.scores,
+                    scratch.weights[t][i].zScore);
+            }
+        }
+    }
+
+    void TeamGlicko2System::ProcessMatch(MatchResult& match, MatchScratch& scratch,
+                                          const Glicko2Config& config) {
+        // Same pipeline as the constant-folded overload, with the player
+        // update routed through the runtime config
+        scratch.Clear();
 
         for (const auto& player : match.teamA) {
-            teamARatings.push_back(player.rating);
-            teamAPerformance.push_back(player.performanceScore);
+            scratch.teamAMu.push_back(player.rating.GetMu());
+            scratch.teamAPhi.push_back(player.rating.GetPhi());
+            scratch.teamAPerformance.push_back(player.performanceScore);
         }
 
         for (const auto& player : match.teamB) {
-            teamBRatings.push_back(player.rating);
-            teamBPerformance.push_back(player.performanceScore);
+            scratch.teamBMu.push_back(player.rating.GetMu());
+            scratch.teamBPhi.push_back(player.rating.GetPhi());
+            scratch.teamBPerformance.push_back(player.performanceScore);
         }
 
-        // Step 2: Compute team aggregated ratings
-        TeamRatingStats statsA = TeamRatingAggregator::ComputeTeamStats(teamARatings);
-        TeamRatingStats statsB = TeamRatingAggregator::ComputeTeamStats(teamBRatings);
+        TeamRatingStats statsA = TeamRatingAggregator::ComputeTeamStats(
+            scratch.teamAMu.data(), scratch.teamAPhi.data(), scratch.teamAMu.size());
+        TeamRatingStats statsB = TeamRatingAggregator::ComputeTeamStats(
+            scratch.teamBMu.data(), scratch.teamBPhi.data(), scratch.teamBMu.size());
+        OpponentContext contextA = OpponentContext::FromTeamStats(statsA);
+        OpponentContext contextB = OpponentContext::FromTeamStats(statsB);
 
-        // Step 3: Compute performance z-scores for each team
-        std::vector<PlayerWeight> weightsA = PerformanceWeighting::ComputeZScores(teamAPerformance);
-        std::vector<PlayerWeight> weightsB = PerformanceWeighting::ComputeZScores(teamBPerformance);
+        PerformanceWeighting::ComputeZScores(scratch.teamAPerformance, scratch.weightsA);
+        PerformanceWeighting::ComputeZScores(scratch.teamBPerformance, scratch.weightsB);
 
-        // Step 4: Update ratings for Team A players
         for (size_t i = 0; i < match.teamA.size(); ++i) {
-            match.teamA[i].rating = UpdatePlayerRating(
+            UpdatePlayerRatingInPlace(
                 match.teamA[i].rating,
-                statsB.mu,
-                statsB.phi,
+                contextB,
                 match.scoreA,
-                weightsA[i].zScore);
+                scratch.weightsA[i].zScore,
+                config);
         }
 
-        // Step 5: Update ratings for Team B players
         for (size_t i = 0; i < match.teamB.size(); ++i) {
-            match.teamB[i].rating = UpdatePlayerRating(
+            UpdatePlayerRatingInPlace(
                 match.teamB[i].rating,
-                statsA.mu,
-                statsA.phi,
+                contextA,
                 match.scoreB,
-                weightsB[i].zScore);
+                scratch.weightsB[i].zScore,
+                config);
         }
     }
 
+    namespace {
+        /// Visit every player of a match, either container form
+        template <typename Fn>
+        void ForEachPlayer(const MatchResult& match, Fn fn) {
+            for (const auto& player : match.teamA) fn(player);
+            for (const auto& player : match.teamB) fn(player);
+        }
+
+        template <typename Fn>
+        void ForEachPlayer(const ArenaMatchResult& match, Fn fn) {
+            for (size_t i = 0; i < match.teamACount; ++i) fn(match.teamA[i]);
+            for (size_t i = 0; i < match.teamBCount; ++i) fn(match.teamB[i]);
+        }
+
+        /// Wave-scheduled batch processing shared by the vector and
+        /// arena match forms
+        template <typename MatchT>
+        void ProcessMatchesWaves(MatchT* matches, size_t count, size_t numThreads) {
+            if (count == 0) {
+                return;
+            }
+
+            // Serial fallback: no scheduling overhead needed
+            if (numThreads <= 1 || count == 1) {
+                MatchScratch scratch;
+                for (size_t m = 0; m < count; ++m) {
+                    TeamGlicko2System::ProcessMatch(matches[m], scratch);
+                }
+                return;
+            }
+
+            // Step 1: Partition matches into dependency waves
+            // A match goes into the first wave after the last wave that
+            // touched any of its players, so updates for a shared player
+            // are applied in the original match order
+            std::vector<int> waveOfMatch(count, 0);
+            std::unordered_map<int, int> lastWaveOfPlayer;
+            int maxWave = 0;
+
+            for (size_t m = 0; m < count; ++m) {
+                int wave = 0;
+
+                ForEachPlayer(matches[m], [&](const MatchPlayer& player) {
+                    if (player.playerId < 0) return;
+                    auto it = lastWaveOfPlayer.find(player.playerId);
+                    if (it != lastWaveOfPlayer.end() && it->second + 1 > wave) {
+                        wave = it->second + 1;
+                    }
+                });
+
+                waveOfMatch[m] = wave;
+                if (wave > maxWave) {
+                    maxWave = wave;
+                }
+
+                ForEachPlayer(matches[m], [&](const MatchPlayer& player) {
+                    if (player.playerId >= 0) lastWaveOfPlayer[player.playerId] = wave;
+                });
+            }
+
+            // Group match indices by wave
+            std::vector<std::vector<size_t>> waves(maxWave + 1);
+            for (size_t m = 0; m < count; ++m) {
+                waves[waveOfMatch[m]].push_back(m);
+            }
+
+            // Step 2: Process each wave in order; matches within a wave are
+            // independent and are pulled by workers from a shared counter
+            // Each worker owns a scratch workspace so the steady state
+            // performs no heap allocations
+            MatchScratch serialScratch;
+            for (const auto& wave : waves) {
+                if (wave.size() == 1) {
+                    TeamGlicko2System::ProcessMatch(matches[wave[0]], serialScratch);
+                    continue;
+                }
+
+                size_t workerCount = std::min(numThreads, wave.size());
+                std::atomic<size_t> nextIndex(0);
+
+                std::vector<std::thread> workers;
+                workers.reserve(workerCount);
+                for (size_t w = 0; w < workerCount; ++w) {
+                    workers.emplace_back([matches, &wave, &nextIndex]() {
+                        MatchScratch scratch;
+                        size_t i;
+                        while ((i = nextIndex.fetch_add(1)) < wave.size()) {
+                            TeamGlicko2System::ProcessMatch(matches[wave[i]], scratch);
+                        }
+                    });
+                }
+
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+        }
+    }  // namespace
+
+    void TeamGlicko2System::ProcessMatches(std::vector<MatchResult>& matches, size_t numThreads) {
+        ProcessMatchesWaves(matches.data(), matches.size(), numThreads);
+    }
+
+    void TeamGlicko2System::ProcessMatches(ArenaMatchResult* matches, size_t count,
+                                           size_t numThreads) {
+        ProcessMatchesWaves(matches, count, numThreads);
+    }
+
     PlayerRating TeamGlicko2System::UpdatePlayerRating(
         const PlayerRating& player,
         double opponentMu,
         double opponentPhi,
         double score,
         double zScore) {
+        TeamRatingStats stats;
+        stats.mu = opponentMu;
+        stats.phi = opponentPhi;
+        return UpdatePlayerRating(player, OpponentContext::FromTeamStats(stats), score, zScore);
+    }
+
+    PlayerRating TeamGlicko2System::UpdatePlayerRating(
+        const PlayerRating& player,
+        const OpponentContext& opponent,
+        double score,
+        double zScore) {
+        // The returning form hands back a fresh state (default
+        // performance-tracking fields); the math lives in the
+        // in-place twin
+        PlayerRating updatedRating;
+        updatedRating.SetMu(player.GetMu());
+        updatedRating.SetPhi(player.GetPhi());
+        updatedRating.SetSigma(player.GetSigma());
+        UpdatePlayerRatingInPlace(updatedRating, opponent, score, zScore);
+        return updatedRating;
+    }
+
+    void TeamGlicko2System::UpdatePlayerRatingInPlace(
+        PlayerRating& player,
+        const OpponentContext& opponent,
+        double score,
+        double zScore) {
         // Get current rating parameters
         double mu = player.GetMu();
         double phi = player.GetPhi();
         double sigma = player.GetSigma();
 
-        // Compute g(phi_opp)
-        double phiOppSquared = opponentPhi * opponentPhi;
-        double g = 1.0 / std::sqrt(1.0 + 3.0 * phiOppSquared / (M_PI * M_PI));
+        // g(phi_opp) comes precomputed with the opponent context
+        double g = opponent.g;
 
         // Compute expected score E
-        double expectedScore = player.ComputeExpectedScore(opponentMu, g);
+        double expectedScore = player.ComputeExpectedScore(opponent.mu, g);
 
         // Compute variance v
         double v = ComputeVariance(g, expectedScore);
@@ -98,15 +395,135 @@ namespace TeamGlicko2 {
             muPrime = ClampRatingChange(mu, muPrime);
         }
 
-        // Create and return updated rating
+        // Write the updated state back in place
+        player.SetMu(muPrime);
+        player.SetPhi(phiPrime);
+        player.SetSigma(sigmaPrime);
+    }
+
+    PlayerRating TeamGlicko2System::UpdatePlayerRating(
+        const PlayerRating& player,
+        const std::vector<OpponentContext>& opponents,
+        const std::vector<double>& scores,
+        double zScore) {
+        if (opponents.empty() || opponents.size() != scores.size()) {
+            return player;
+        }
+
+        // The returning form hands back a fresh state (default
+        // performance-tracking fields); the math lives in the
+        // in-place twin
         PlayerRating updatedRating;
-        updatedRating.SetMu(muPrime);
-        updatedRating.SetPhi(phiPrime);
-        updatedRating.SetSigma(sigmaPrime);
+        updatedRating.SetMu(player.GetMu());
+        updatedRating.SetPhi(player.GetPhi());
+        updatedRating.SetSigma(player.GetSigma());
+        UpdatePlayerRatingInPlace(updatedRating, opponents, scores, zScore);
+        return updatedRating;
+    }
+
+    void TeamGlicko2System::UpdatePlayerRatingInPlace(
+        PlayerRating& player,
+        const std::vector<OpponentContext>& opponents,
+        const std::vector<double>& scores,
+        double zScore) {
+        if (opponents.empty() || opponents.size() != scores.size()) {
+            return;
+        }
+
+        double mu = player.GetMu();
+        double phi = player.GetPhi();
+        double sigma = player.GetSigma();
+
+        // Accumulate the variance and improvement terms over all
+        // opponents (Glicko-2 generalizes by summation; the
+        // single-opponent path is the one-term special case)
+        double vInverse = 0.0;
+        double deltaSum = 0.0;
+        for (size_t j = 0; j < opponents.size(); ++j) {
+            double g = opponents[j].g;
+            double expectedScore = player.ComputeExpectedScore(opponents[j].mu, g);
+            vInverse += g * g * expectedScore * (1.0 - expectedScore);
+            deltaSum += g * (scores[j] - expectedScore);
+        }
+
+        double v = 1.0 / vInverse;
+        double delta = v * deltaSum;
+
+        double sigmaPrime = UpdateVolatility(sigma, phi, delta, v);
+        double phiPrime = UpdateRatingDeviation(phi, sigmaPrime, v);
+
+        // mu* = mu + phi'^2 * sum_j g_j (s_j - E_j)
+        double muStar = mu + phiPrime * phiPrime * deltaSum;
+
+        double deltaMu = muStar - mu;
+        double scalingFactor = PerformanceWeighting::ComputeScalingFactor(zScore, deltaMu);
+        double muPrime = mu + scalingFactor * deltaMu;
+
+        if (TeamGlicko2::kEnableRatingClamp) {
+            muPrime = ClampRatingChange(mu, muPrime);
+        }
+
+        player.SetMu(muPrime);
+        player.SetPhi(phiPrime);
+        player.SetSigma(sigmaPrime);
+    }
 
+    PlayerRating TeamGlicko2System::UpdatePlayerRating(
+        const PlayerRating& player,
+        const OpponentContext& opponent,
+        double score,
+        double zScore,
+        const Glicko2Config& config) {
+        // The returning form hands back a fresh state (default
+        // performance-tracking fields); the math lives in the
+        // in-place twin
+        PlayerRating updatedRating;
+        updatedRating.SetMu(player.GetMu());
+        updatedRating.SetPhi(player.GetPhi());
+        updatedRating.SetSigma(player.GetSigma());
+        UpdatePlayerRatingInPlace(updatedRating, opponent, score, zScore, config);
         return updatedRating;
     }
 
+    void TeamGlicko2System::UpdatePlayerRatingInPlace(
+        PlayerRating& player,
+        const OpponentContext& opponent,
+        double score,
+        double zScore,
+        const Glicko2Config& config) {
+        // Runtime-config twin of the overload above; the sequence of
+        // steps is identical, only the tunables are read from config
+        double mu = player.GetMu();
+        double phi = player.GetPhi();
+        double sigma = player.GetSigma();
+
+        double g = opponent.g;
+        double expectedScore = player.ComputeExpectedScore(opponent.mu, g);
+        double v = ComputeVariance(g, expectedScore);
+        double delta = ComputeDelta(v, g, score, expectedScore);
+
+        double sigmaPrime = UpdateVolatility(sigma, phi, delta, v, config);
+        double phiPrime = UpdateRatingDeviation(phi, sigmaPrime, v);
+        double muStar = UpdateRatingMean(mu, phiPrime, g, score, expectedScore);
+
+        double deltaMu = muStar - mu;
+        double scalingFactor = PerformanceWeighting::ComputeScalingFactor(
+            zScore, deltaMu, config.beta, config.scaleMin, config.scaleMax);
+        double muPrime = mu + scalingFactor * deltaMu;
+
+        if (config.enableRatingClamp) {
+            double change = muPrime - mu;
+            if (std::abs(change) > config.maxRatingChange) {
+                muPrime = change > 0.0 ? mu + config.maxRatingChange
+                                       : mu - config.maxRatingChange;
+            }
+        }
+
+        player.SetMu(muPrime);
+        player.SetPhi(phiPrime);
+        player.SetSigma(sigmaPrime);
+    }
+
     double TeamGlicko2System::ComputeVariance(double g, double expectedScore) {
         // v = [g^2 * E * (1 - E)]^(-1)
         double denominator = g * g * expectedScore * (1.0 - expectedScore);
@@ -125,6 +542,11 @@ namespace TeamGlicko2 {
         double v) {
         // Implementation of the Illinois algorithm for volatility convergence
         // Based on Step 5 of the Glicko-2 paper
+        // Both the bracketing walk and the Illinois iteration are hard
+        // capped so one pathological match can never stall a synchronous
+        // update: on cap the current bracket estimate is returned, which
+        // after kMaxVolatilityIterations halvings is already far inside
+        // any practically relevant tolerance
 
         double deltaSquared = delta * delta;
         double phiSquared = phi * phi;
@@ -138,18 +560,23 @@ namespace TeamGlicko2 {
         if (deltaSquared > phiSquared + v) {
             B = std::log(deltaSquared - phiSquared - v);
         } else {
-            // Find B by iterating downward
+            // Find B by iterating downward (bounded walk)
             B = a - TeamGlicko2::kTau;
-            while (VolatilityFunction(B, deltaSquared, phiSquared, v, a, tauSquared) < 0.0) {
+            int bracketSteps = 1;
+            while (VolatilityFunction(B, deltaSquared, phiSquared, v, a, tauSquared) < 0.0 &&
+                   bracketSteps < TeamGlicko2::kMaxVolatilityBracketSteps) {
                 B -= TeamGlicko2::kTau;
+                bracketSteps++;
             }
         }
 
-        // Illinois algorithm iteration
+        // Illinois algorithm iteration (bounded)
         double fA = VolatilityFunction(A, deltaSquared, phiSquared, v, a, tauSquared);
         double fB = VolatilityFunction(B, deltaSquared, phiSquared, v, a, tauSquared);
 
-        while (std::abs(B - A) > TeamGlicko2::kConvergence) {
+        int iterations = 0;
+        while (std::abs(B - A) > TeamGlicko2::kConvergence &&
+               iterations < TeamGlicko2::kMaxVolatilityIterations) {
             double C = A + (A - B) * fA / (fB - fA);
             double fC = VolatilityFunction(C, deltaSquared, phiSquared, v, a, tauSquared);
 
@@ -162,12 +589,69 @@ namespace TeamGlicko2 {
 
             B = C;
             fB = fC;
+            iterations++;
         }
 
+        TEAMGLICKO2_INSTRUMENT_VOLATILITY_ITERATIONS(iterations);
+
         // Return new volatility
         return std::exp(A / 2.0);
     }
 
+    double TeamGlicko2System::UpdateVolatility(
+        double sigma,
+        double phi,
+        double delta,
+        double v,
+        const Glicko2Config& config) {
+        // Same Illinois solver as above with tau, tolerance and the
+        // iteration caps taken from the runtime config
+        double deltaSquared = delta * delta;
+        double phiSquared = phi * phi;
+        double tauSquared = config.tau * config.tau;
+        double a = std::log(sigma * sigma);
+
+        double A = a;
+        double B;
+
+        if (deltaSquared > phiSquared + v) {
+            B = std::log(deltaSquared - phiSquared - v);
+        } else {
+            B = a - config.tau;
+            int bracketSteps = 1;
+            while (VolatilityFunction(B, deltaSquared, phiSquared, v, a, tauSquared) < 0.0 &&
+                   bracketSteps < config.maxVolatilityBracketSteps) {
+                B -= config.tau;
+                bracketSteps++;
+            }
+        }
+
+        double fA = VolatilityFunction(A, deltaSquared, phiSquared, v, a, tauSquared);
+        double fB = VolatilityFunction(B, deltaSquared, phiSquared, v, a, tauSquared);
+
+        int iterations = 0;
+        while (std::abs(B - A) > config.convergence &&
+               iterations < config.maxVolatilityIterations) {
+            double C = A + (A - B) * fA / (fB - fA);
+            double fC = VolatilityFunction(C, deltaSquared, phiSquared, v, a, tauSquared);
+
+            if (fC * fB < 0.0) {
+                A = B;
+                fA = fB;
+            } else {
+                fA /= 2.0;
+            }
+
+            B = C;
+            fB = fC;
+            iterations++;
+        }
+
+        TEAMGLICKO2_INSTRUMENT_VOLATILITY_ITERATIONS(iterations);
+
+        return std::exp(A / 2.0);
+    }
+
     double TeamGlicko2System::VolatilityFunction(
         double x,
         double deltaSquared,
@@ -213,6 +697,7 @@ namespace TeamGlicko2 {
         double deltaMu = muPrime - mu;
 
         if (std::abs(deltaMu) > TeamGlicko2::kMaxRatingChange) {
+            TEAMGLICKO2_INSTRUMENT_ADD(clampActivations, 1);
             if (deltaMu > 0.0) {
                 return mu + TeamGlicko2::kMaxRatingChange;
             } else {
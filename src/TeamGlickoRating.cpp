@@ -15,30 +15,19 @@ namespace TeamGlicko2 {
         // Initialize recent performance tracking
         perfIndexEMA = 0.0;
         perfGames = 0;
-    }
 
-    PlayerRating::PlayerRating(const PlayerRating& other)
-        : mu(other.mu), phi(other.phi), sigma(other.sigma),
-          perfIndexEMA(other.perfIndexEMA), perfGames(other.perfGames){
-    }
-
-    PlayerRating& PlayerRating::operator=(const PlayerRating& other) {
-        if (this != &other) {
-            mu = other.mu;
-            phi = other.phi;
-            sigma = other.sigma;
-            perfIndexEMA = other.perfIndexEMA;
-            perfGames = other.perfGames;
-        }
-        return *this;
+        cachedEffectiveRating = 0.0;
+        effectiveRatingValid = false;
     }
 
     void PlayerRating::SetRating(double rating) {
         mu = (rating - TeamGlicko2::kDefaultRating) / TeamGlicko2::kScale;
+        InvalidateEffectiveRating();
     }
 
     void PlayerRating::SetRD(double rd) {
         phi = rd / TeamGlicko2::kScale;
+        InvalidateEffectiveRating();
     }
 
     double PlayerRating::ComputeG() const {
@@ -90,6 +79,8 @@ namespace TeamGlicko2 {
                 break;  // Already at maximum, no need to continue
             }
         }
+
+        InvalidateEffectiveRating();
     }
 
     void PlayerRating::UpdateRecentPerformance(double matchPerfIndex, double targetWindow) {
@@ -111,6 +102,7 @@ namespace TeamGlicko2 {
 
         perfIndexEMA = (1.0 - alpha) * perfIndexEMA + alpha * matchPerfIndex;
         perfGames++;
+        InvalidateEffectiveRating();
     }
 
     double PlayerRating::ComputeRecentRating(double perfToRating) const {
@@ -127,6 +119,14 @@ namespace TeamGlicko2 {
     }
 
     double PlayerRating::ComputeEffectiveRating(double perfToRating, double rdScale) const {
+        // Fast path: the default-parameter result is cached between
+        // rating writes, which is what matchmaking reads hit
+        bool defaultParams = (perfToRating == TeamGlicko2::kPerfToRating &&
+                              rdScale == TeamGlicko2::kRDScaleConstant);
+        if (defaultParams && effectiveRatingValid) {
+            return cachedEffectiveRating;
+        }
+
         double r_g = GetRating();           // Long-term Glicko rating
         double r_rec = ComputeRecentRating(perfToRating);  // Recent performance rating
         double rd = GetRD();
@@ -143,6 +143,11 @@ namespace TeamGlicko2 {
         // Blend: r_true = r_g + w * (r_rec - r_g)
         double r_true = r_g + w * (r_rec - r_g);
 
+        if (defaultParams) {
+            cachedEffectiveRating = r_true;
+            effectiveRatingValid = true;
+        }
+
         return r_true;
     }
 
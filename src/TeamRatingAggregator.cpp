@@ -3,46 +3,94 @@
 
 namespace TeamGlicko2 {
     TeamRatingStats TeamRatingAggregator::ComputeTeamStats(const std::vector<PlayerRating>& team) {
+        return ComputeTeamStats(team.data(), team.size());
+    }
+
+    TeamRatingStats TeamRatingAggregator::ComputeTeamStats(
+        const PlayerRating* team, std::size_t n) {
         TeamRatingStats stats;
-        stats.teamSize = team.size();
+        stats.teamSize = static_cast<int>(n);
 
-        if (stats.teamSize == 0) {
+        if (n == 0) {
             return stats;
         }
 
-        stats.mu = ComputeTeamMu(team);
-        stats.phi = ComputeTeamPhi(team);
+        stats.mu = ComputeTeamMu(team, n);
+        stats.phi = ComputeTeamPhi(team, n);
 
         return stats;
     }
 
+    TeamRatingStats TeamRatingAggregator::ComputeTeamStats(
+        const double* mu, const double* phi, std::size_t n) {
+        TeamRatingStats stats;
+        stats.teamSize = static_cast<int>(n);
+
+        if (n == 0) {
+            return stats;
+        }
+
+        // Both reductions are dense unit-stride sums over plain arrays;
+        // fused in one loop so mu and phi are read in the same pass
+        double muSum = 0.0;
+        double phiSumSquares = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            muSum += mu[i];
+            phiSumSquares += phi[i] * phi[i];
+        }
+
+        stats.mu = muSum / n;
+        stats.phi = std::sqrt(phiSumSquares / (static_cast<double>(n) * n));
+        return stats;
+    }
+
+    void TeamRatingAggregator::ComputeTeamStatsBatch(
+        const double* mu,
+        const double* phi,
+        const std::size_t* offsets,
+        const std::size_t* sizes,
+        std::size_t numTeams,
+        TeamRatingStats* outStats) {
+        for (std::size_t t = 0; t < numTeams; ++t) {
+            outStats[t] = ComputeTeamStats(mu + offsets[t], phi + offsets[t], sizes[t]);
+        }
+    }
+
     double TeamRatingAggregator::ComputeTeamMu(const std::vector<PlayerRating>& team) {
-        if (team.empty()) {
+        return ComputeTeamMu(team.data(), team.size());
+    }
+
+    double TeamRatingAggregator::ComputeTeamMu(const PlayerRating* team, std::size_t n) {
+        if (n == 0) {
             return 0.0;
         }
 
         // mu_T = (1/|T|) * sum(mu_i for i in T)
         double sum = 0.0;
-        for (const auto& player : team) {
-            sum += player.GetMu();
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += team[i].GetMu();
         }
 
-        return sum / team.size();
+        return sum / n;
     }
 
     double TeamRatingAggregator::ComputeTeamPhi(const std::vector<PlayerRating>& team) {
-        if (team.empty()) {
+        return ComputeTeamPhi(team.data(), team.size());
+    }
+
+    double TeamRatingAggregator::ComputeTeamPhi(const PlayerRating* team, std::size_t n) {
+        if (n == 0) {
             return 0.0;
         }
 
         // phi_T = sqrt((1/|T|^2) * sum(phi_i^2 for i in T))
         double sumSquares = 0.0;
-        for (const auto& player : team) {
-            double phi = player.GetPhi();
+        for (std::size_t i = 0; i < n; ++i) {
+            double phi = team[i].GetPhi();
             sumSquares += phi * phi;
         }
 
-        int teamSize = team.size();
+        int teamSize = static_cast<int>(n);
         return std::sqrt(sumSquares / (teamSize * teamSize));
     }
 